@@ -200,12 +200,33 @@ TeensyUserInterface::TeensyUserInterface(void)
 //          font -> the font typeface to load, ei: Arial_10
 //
 void TeensyUserInterface::begin(int lcdCSPin, int LcdDCPin, int TouchScreenCSPin, int lcdOrientation, const ui_font &font)
+{
+  begin(lcdCSPin, LcdDCPin, TouchScreenCSPin, 255, lcdOrientation, font);
+}
+
+
+
+//
+// initialize the UI, display hardware and touchscreen hardware, using the touchscreen's
+// IRQ pin so the touch controller is only read over SPI while the screen is touched
+//  Enter:  lcdCSPin = pin number for the LCD's CS pin
+//          LcdDCPin = pin number for the LCD's DC pin
+//          TouchScreenCSPin = pin number for the touchscreen's CS pin
+//          TouchScreenIRQPin = pin number for the touchscreen's T_IRQ pin, 255 to poll instead
+//          lcdOrientation = LCD_ORIENTATION_PORTRAIT_4PIN_TOP, LCD_ORIENTATION_LANDSCAPE_4PIN_LEFT
+//                           LCD_ORIENTATION_PORTRAIT_4PIN_BOTTOM, LCD_ORIENTATION_LANDSCAPE_4PIN_RIGHT
+//          font -> the font typeface to load, ei: Arial_10
+//
+void TeensyUserInterface::begin(int lcdCSPin, int LcdDCPin, int TouchScreenCSPin, int TouchScreenIRQPin, int lcdOrientation, const ui_font &font)
 {
   //
   // create the LCD and touchscreen objects
   //
   lcd = new ILI9341_t3(lcdCSPin, LcdDCPin);
-  ts = new XPT2046_Touchscreen(TouchScreenCSPin);
+  ts = new XPT2046_Touchscreen(TouchScreenCSPin, TouchScreenIRQPin);
+  touchScreenIRQPin = TouchScreenIRQPin;
+  touchScreenReadCount = 0;
+  touchScreenReadsSkipped = 0;
   
   //
   // initialize the LCD and touch screen hardware
@@ -1402,14 +1423,14 @@ void TeensyUserInterface::drawButton(const char *labelText, int buttonX, int but
 
 //
 // draw an Image button
-//  Enter:  buttonImage -> Image to display for the button
+//  Enter:  buttonImage -> run length encoded image to display for the button
 //          buttonX, buttonY = screen coords for the button's upper left corner
 //          buttonWidth, buttonHeight = size of the button
 //
 void TeensyUserInterface::drawButton(const char *buttonText,const uint16_t* buttonImage, int buttonX, int buttonY, int buttonWidth,
                                      int buttonHeight, uint16_t buttonTextColor, const ui_font &buttonFont)
 {
-    lcdDrawImage(buttonX, buttonY, buttonWidth, buttonHeight, buttonImage);
+    lcdDrawImageRLE(buttonX, buttonY, buttonWidth, buttonHeight, buttonImage);
     lcdSetFont(buttonFont);
     lcdSetFontColor(buttonTextColor);
     lcdSetCursorXY(buttonX + buttonWidth/2, buttonY + (buttonHeight / 2) - (lcdGetFontHeightWithoutDecenders()/2));
@@ -2116,7 +2137,9 @@ void TeensyUserInterface::drawNumberInNumberBox(NUMBER_BOX &numberBox)
   // draw the number
   //
   lcdSetCursorXY(numberX + numberWidth/2, textY);
-  if (numberBox.isNoteBox){
+  if (numberBox.valueLabels != nullptr){
+      lcdPrintCentered(numberBox.valueLabels[numberBox.value]);
+  } else if (numberBox.isNoteBox){
       lcdPrintCentered(notes[numberBox.value].c_str());
   } else if (numberBox.isScaleBox) {
       lcdPrintCentered(scales[numberBox.value].c_str());
@@ -2801,6 +2824,8 @@ boolean TeensyUserInterface::checkForTouchEventInRect(int eventType, int rectX1,
 // check touch screen for new events
 //  Exit:   touchEventType = touch event type, TOUCH_NO_EVENT if no event
 //          touchEventX, touchEventY = LCD coordinates of touch event 
+//          touchScreenReadCount, touchScreenReadsSkipped = count of calls that did and 
+//            didn't read the touch controller
 //
 void TeensyUserInterface::getTouchEvents(void)
 {
@@ -2814,9 +2839,21 @@ void TeensyUserInterface::getTouchEvents(void)
 
   touchEventType = TOUCH_NO_EVENT;                          // assume there will be no touch event
 
+  //
+  // when using the IRQ pin, don't read the touch controller over SPI while waiting for a 
+  // touch unless the controller has signaled one, every other state still samples so the 
+  // debounce and auto repeat timing is unchanged
+  //
+  if ((touchState == WAITING_FOR_TOUCH_DOWN_STATE) && (touchScreenIRQPin != 255) && !ts->tirqTouched())
+  {
+    touchScreenReadsSkipped++;
+    return;
+  }
+
   //
   // check if anything is touched now
   //
+  touchScreenReadCount++;
   currentlyTouched = getTouchScreenCoords(&currentTouchX, &currentTouchY);
 
   //
@@ -3302,6 +3339,51 @@ void TeensyUserInterface::lcdDrawImage(int x, int y, int width, int height, cons
 
 
 
+//
+// draw a run length encoded image, decoding one line at a time into the LCD
+//  Enter:  x, y = coords of upper left corner on LCD where the image will be displayed
+//          width, height =  size of the image, this must be the same as the image data
+//          image -> RLE image data stored in PROGMEM, each row is a sequence of packets
+//            starting with a header word: 0x8000 | n is followed by one color repeated
+//            n times, n alone is followed by n literal colors
+// Note: use tools/compress_images.py to convert ImageConverter 565 output to this format
+//
+void TeensyUserInterface::lcdDrawImageRLE(int x, int y, int width, int height, const uint16_t *image)
+{
+  uint16_t lineBuffer[320];
+  const uint16_t *rlePntr = image;
+
+  if ((width <= 0) || (width > 320))
+    return;
+
+  for (int row = 0; row < height; row++)
+  {
+    int pixelCount = 0;
+    while (pixelCount < width)
+    {
+      uint16_t header = *rlePntr++;
+      int packetLength = header & 0x7fff;
+
+      if (header & 0x8000)
+      {
+        uint16_t color = *rlePntr++;
+        for (int i = 0; i < packetLength; i++)
+          lineBuffer[pixelCount++] = color;
+      }
+      else
+      {
+        memcpy(&lineBuffer[pixelCount], rlePntr, packetLength * sizeof(uint16_t));
+        rlePntr += packetLength;
+        pixelCount += packetLength;
+      }
+    }
+
+    lcd->writeRect(x, y + row, width, 1, lineBuffer);
+  }
+}
+
+
+
 //
 // set the text font for the "print" functions
 //  Enter:  font -> the font typeface to load
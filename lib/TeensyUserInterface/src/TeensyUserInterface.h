@@ -107,7 +107,7 @@ typedef struct
 } BUTTON_EXTENDED;
 
 //
-// definition of an Image Button, using two images to display pressed and unpressed states
+// definition of an Image Button, using two run length encoded images to display pressed and unpressed states
 //
 typedef struct
 {
@@ -139,6 +139,7 @@ typedef struct
   int height;
   bool isNoteBox = false;
   bool isScaleBox = false;
+  const char * const *valueLabels = nullptr;    // when set, valueLabels[value] is shown instead of the number
 } NUMBER_BOX;
 
 
@@ -241,6 +242,8 @@ class TeensyUserInterface
     int touchEventType;
     int touchEventX;
     int touchEventY;
+    unsigned long touchScreenReadCount;
+    unsigned long touchScreenReadsSkipped;
     byte toggleSelectNextStateFlg;
     const char *toggleText;
 
@@ -250,6 +253,7 @@ class TeensyUserInterface
     //
     TeensyUserInterface(void);
     void begin(int lcdCSPin, int LcdDCPin, int TouchScreenCSPin, int lcdOrientation, const ui_font &font);
+    void begin(int lcdCSPin, int LcdDCPin, int TouchScreenCSPin, int TouchScreenIRQPin, int lcdOrientation, const ui_font &font);
     void setOrientation(int lcdOrientation);
     void setColorPaletteBlue(void);
     void setColorPaletteGray(void);
@@ -316,6 +320,7 @@ class TeensyUserInterface
     void lcdDrawFilledTriangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t color);
     void lcdDrawFilledCircle(int x, int y, int radius, uint16_t color);
     void lcdDrawImage(int x, int y, int width, int height, const uint16_t *image);
+    void lcdDrawImageRLE(int x, int y, int width, int height, const uint16_t *image);
     void lcdSetFont(const ui_font &font);
     void lcdSetFontColor(uint16_t color);
     void lcdPrint(char *s);
@@ -379,6 +384,7 @@ class TeensyUserInterface
     int touchScreenToLCDOffsetY;
     float touchScreenToLCDScalerY;
     int touchState;
+    int touchScreenIRQPin;
 
 
     //
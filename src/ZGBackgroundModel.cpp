@@ -0,0 +1,139 @@
+//
+// ZGBackgroundModel.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGBackgroundModel.h"
+
+ZGBackgroundModel::ZGBackgroundModel() = default;
+
+ZGBackgroundModel::~ZGBackgroundModel() = default;
+
+void ZGBackgroundModel::calibrate() {
+    for (int i = 0; i < ANGLE_BINS; i++) {
+        mRanges[i] = 0;
+        mCounts[i] = 0;
+        for (int candidate = 0; candidate < CANDIDATES; candidate++) {
+            mCandidateRanges[i][candidate] = 0;
+            mCandidateCounts[i][candidate] = 0;
+        }
+    }
+    mCalibrationLeft = CALIBRATION_REVOLUTIONS;
+    mCalibrated = false;
+}
+
+void ZGBackgroundModel::update(const ZGRangeImage &inImage) {
+    if (isCalibrating()) {
+        for (int i = 0; i < ZGRangeImage::ANGLE_BINS; i++) {
+            auto distance = inImage.getDistance(i);
+            if (distance != 0) {
+                _calibrateSample(_getBin(ZGRangeImage::getAngle(i)), distance);
+            }
+        }
+        if (--mCalibrationLeft == 0) {
+            _finishCalibration();
+        }
+    } else if (mEnabled && mCalibrated) {
+        for (int i = 0; i < ZGRangeImage::ANGLE_BINS; i++) {
+            auto distance = inImage.getDistance(i);
+            if (distance != 0) {
+                _updateSample(_getBin(ZGRangeImage::getAngle(i)), distance);
+            }
+        }
+    }
+}
+
+void ZGBackgroundModel::_calibrateSample(int inBin, float inDistance) {
+    auto* ranges = mCandidateRanges[inBin];
+    auto* counts = mCandidateCounts[inBin];
+    auto weakest = 0;
+    for (int candidate = 0; candidate < CANDIDATES; candidate++) {
+        auto& range = ranges[candidate];
+        if (range != 0 && std::abs(inDistance - range) <= TOLERANCE) {
+            counts[candidate]++;
+            range += (inDistance - range) / static_cast<float>(counts[candidate]);
+            return;
+        }
+        if (counts[candidate] < counts[weakest]) {
+            weakest = candidate;
+        }
+    }
+    // A surface nobody has counted yet replaces the least seen candidate, never the one most of the hits went to
+    ranges[weakest] = inDistance;
+    counts[weakest] = 1;
+}
+
+void ZGBackgroundModel::_finishCalibration() {
+    // The most often seen range wins, bins where even that was rarely hit are open space or noise
+    for (int i = 0; i < ANGLE_BINS; i++) {
+        auto best = 0;
+        for (int candidate = 1; candidate < CANDIDATES; candidate++) {
+            if (mCandidateCounts[i][candidate] > mCandidateCounts[i][best]) {
+                best = candidate;
+            }
+        }
+        mRanges[i] = mCandidateCounts[i][best] >= MIN_CALIBRATION_HITS ? mCandidateRanges[i][best] : 0;
+        mCounts[i] = 0;
+    }
+    mCalibrated = true;
+}
+
+void ZGBackgroundModel::_updateSample(int inBin, float inDistance) {
+    auto& range = mRanges[inBin];
+    auto& count = mCounts[inBin];
+    if (range == 0) {
+        return;
+    }
+    if (std::abs(inDistance - range) <= TOLERANCE) {
+        range += (inDistance - range) * UPDATE_GAIN;
+        count = 0;
+    } else if (inDistance > range + TOLERANCE && ++count >= FARTHER_REVOLUTIONS) {
+        // The old surface has been gone long enough, eg. a door was opened or a stand was moved
+        range = inDistance;
+        count = 0;
+    }
+}
+
+bool ZGBackgroundModel::isBackground(float inAngle, float inDistance) const {
+    if (!mEnabled || !mCalibrated) {
+        return false;
+    }
+    auto bin = _getBin(inAngle);
+    auto range = mRanges[bin];
+    if (range == 0) {
+        return false;
+    }
+    // Neighbours on the same surface cover angle jitter, a nearer surface across a depth edge must not hide people
+    // standing in front of this one
+    auto threshold = range;
+    for (int offset = -1; offset <= 1; offset += 2) {
+        auto neighbour = mRanges[(bin + offset + ANGLE_BINS) % ANGLE_BINS];
+        if (neighbour != 0 && std::abs(neighbour - range) <= TOLERANCE) {
+            threshold = std::min(threshold, neighbour);
+        }
+    }
+    return inDistance >= threshold - TOLERANCE;
+}
+
+int ZGBackgroundModel::_getBin(float inAngle) {
+    auto bin = static_cast<int>(inAngle * (ANGLE_BINS / 360.f));
+    return std::min(std::max(bin, 0), ANGLE_BINS - 1);
+}
+
+const bool &ZGBackgroundModel::isEnabled() const {
+    return mEnabled;
+}
+
+void ZGBackgroundModel::setEnabled(bool inEnabled) {
+    mEnabled = inEnabled;
+    if (mEnabled && !mCalibrated && !isCalibrating()) {
+        calibrate();
+    }
+}
+
+bool ZGBackgroundModel::isCalibrating() const {
+    return mCalibrationLeft > 0;
+}
@@ -0,0 +1,84 @@
+//
+// ZGBackgroundModel.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <cmath>
+#include "ZGRangeImage.h"
+
+#pragma once
+
+/**
+ * @brief Learned range of the static surroundings, such as walls, stands and speakers, for every angle bin. Calibration
+ * counts hits on a few candidate ranges per bin and keeps the one seen most often, so people walking through while it
+ * runs and single returns through gaps are not learned. Afterwards the ranges follow slow drift, and a bin only moves further away once the old surface has been
+ * gone for a while. Closer surfaces are never learned automatically so someone standing still is not removed, a new
+ * calibration picks them up.
+ */
+class ZGBackgroundModel {
+public:
+    static constexpr int ANGLE_BINS = 720;
+    static constexpr int CALIBRATION_REVOLUTIONS = 50;
+
+    /* */
+    ZGBackgroundModel();
+
+    /* */
+    ~ZGBackgroundModel();
+
+    /**
+     * @brief Forgets the current background and learns a new one from the next CALIBRATION_REVOLUTIONS revolutions
+     */
+    void calibrate();
+
+    /**
+     * @brief Feeds one revolution of samples into calibration or the slow update. Call once per revolution before
+     * filtering its points
+     */
+    void update(const ZGRangeImage& inImage);
+
+    /**
+     * @return True if the sample is at or behind the learned background of its bin. A neighbour within TOLERANCE of
+     * the bin's range can lower it, which covers angle jitter along a surface without reaching across depth edges.
+     * Always false while calibrating or disabled
+     */
+    bool isBackground(float inAngle, float inDistance) const;
+
+    const bool& isEnabled() const;
+
+    /**
+     * @brief Turns background removal on or off. Turning it on without a learned background starts a calibration
+     */
+    void setEnabled(bool inEnabled);
+
+    bool isCalibrating() const;
+
+private:
+
+    static constexpr float TOLERANCE = 15.f;                // cm either side of the background that still counts
+    static constexpr float UPDATE_GAIN = 1.f / 64.f;
+    static constexpr int MIN_CALIBRATION_HITS = CALIBRATION_REVOLUTIONS / 4;
+    static constexpr int FARTHER_REVOLUTIONS = 100;         // Roughly 10 seconds before a farther surface is learned
+    static constexpr int CANDIDATES = 3;                    // Ranges counted per bin during calibration
+
+    static int _getBin(float inAngle);
+
+    void _calibrateSample(int inBin, float inDistance);
+
+    void _updateSample(int inBin, float inDistance);
+
+    void _finishCalibration();
+
+    float mRanges[ANGLE_BINS] {};       // cm, 0 where the bin has no background
+    uint16_t mCounts[ANGLE_BINS] {};    // Revolutions a farther surface was seen
+    float mCandidateRanges[ANGLE_BINS][CANDIDATES] {};      // cm, 0 is an unused candidate
+    uint16_t mCandidateCounts[ANGLE_BINS][CANDIDATES] {};
+    int mCalibrationLeft = 0;
+    bool mEnabled = false;
+    bool mCalibrated = false;
+
+};
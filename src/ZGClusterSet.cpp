@@ -0,0 +1,96 @@
+//
+// ZGClusterSet.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGClusterSet.h"
+
+ZGClusterSet::ZGClusterSet() {
+    mPointIndices.reserve(ZGPointCloud::MAX_POINTS);
+}
+
+ZGClusterSet::~ZGClusterSet() = default;
+
+void ZGClusterSet::build(const ZGPointCloud &inCloud, int inClusterCount) {
+    mCloud = &inCloud;
+    mCount = inClusterCount;
+    mStats.assign(mCount, ZGClusterStats {});
+
+    // Count, centroid, bounds and covariance in one pass with Welford's update, which stays accurate in float at
+    // ranges of several meters
+    for (int i = 0; i < inCloud.size(); i++) {
+        auto label = inCloud.getLabel(i);
+        if (label <= 0) {
+            continue;
+        }
+        auto& stats = mStats[label - 1];
+        auto x = inCloud.getX(i);
+        auto y = inCloud.getY(i);
+        if (stats.count == 0) {
+            stats.minX = stats.maxX = x;
+            stats.minY = stats.maxY = y;
+        }
+        stats.count++;
+        auto dx = x - stats.centerX;
+        auto dy = y - stats.centerY;
+        stats.centerX += dx / static_cast<float>(stats.count);
+        stats.centerY += dy / static_cast<float>(stats.count);
+        stats.varianceX += dx * (x - stats.centerX);
+        stats.varianceY += dy * (y - stats.centerY);
+        stats.covarianceXY += dx * (y - stats.centerY);
+        stats.minX = std::min(stats.minX, x);
+        stats.maxX = std::max(stats.maxX, x);
+        stats.minY = std::min(stats.minY, y);
+        stats.maxY = std::max(stats.maxY, y);
+        stats.latestTime = std::max(stats.latestTime, inCloud.getTime(i));
+    }
+
+    mOffsets.resize(mCount + 1);
+    mOffsets[0] = 0;
+    for (int cluster = 0; cluster < mCount; cluster++) {
+        auto& stats = mStats[cluster];
+        mOffsets[cluster + 1] = static_cast<uint16_t>(mOffsets[cluster] + stats.count);
+        if (stats.count > 0) {
+            stats.varianceX /= static_cast<float>(stats.count);
+            stats.varianceY /= static_cast<float>(stats.count);
+            stats.covarianceXY /= static_cast<float>(stats.count);
+        }
+    }
+
+    // Place the indices, the offsets are used as write positions and shifted back afterwards
+    mPointIndices.resize(mOffsets[mCount]);
+    for (int i = 0; i < inCloud.size(); i++) {
+        auto label = inCloud.getLabel(i);
+        if (label > 0) {
+            mPointIndices[mOffsets[label - 1]++] = static_cast<uint16_t>(i);
+        }
+    }
+    for (int cluster = mCount; cluster > 0; cluster--) {
+        mOffsets[cluster] = mOffsets[cluster - 1];
+    }
+    mOffsets[0] = 0;
+}
+
+void ZGClusterSet::clear() {
+    mCount = 0;
+}
+
+int ZGClusterSet::size() const {
+    return mCount;
+}
+
+ZGClusterSpan ZGClusterSet::operator[](int inCluster) const {
+    auto indices = mPointIndices.data();
+    return {mCloud, indices + mOffsets[inCluster], indices + mOffsets[inCluster + 1], &mStats[inCluster]};
+}
+
+ZGClusterSet::Iterator ZGClusterSet::begin() const {
+    return {this, 0};
+}
+
+ZGClusterSet::Iterator ZGClusterSet::end() const {
+    return {this, mCount};
+}
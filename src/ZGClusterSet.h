@@ -0,0 +1,127 @@
+//
+// ZGClusterSet.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <vector>
+#include "ZGPointCloud.h"
+
+#pragma once
+
+/**
+ * @brief Shape of one cluster, all distances in cm
+ */
+struct ZGClusterStats {
+    int count = 0;
+    float centerX = 0;
+    float centerY = 0;
+    float minX = 0;
+    float minY = 0;
+    float maxX = 0;
+    float maxY = 0;
+    float varianceX = 0;
+    float varianceY = 0;
+    float covarianceXY = 0;
+    uint32_t latestTime = 0;    // micros() of the newest sample, the position is only known once it arrived
+
+    /**
+     * @return The centroid, timed by the newest sample
+     */
+    ZGPoint getCenter() const {
+        ZGPoint p {centerX, centerY};
+        p.time = latestTime;
+        return p;
+    }
+};
+
+/**
+ * @brief The points of one cluster, a range of the label sorted index array resolved through the point cloud
+ */
+class ZGClusterSpan {
+public:
+    class Iterator {
+    public:
+        Iterator(const ZGPointCloud* inCloud, const uint16_t* inIndex) : mCloud(inCloud), mIndex(inIndex) {}
+        ZGPoint operator*() const { return mCloud->getPoint(*mIndex); }
+        Iterator& operator++() { ++mIndex; return *this; }
+        bool operator!=(const Iterator& inOther) const { return mIndex != inOther.mIndex; }
+    private:
+        const ZGPointCloud* mCloud;
+        const uint16_t* mIndex;
+    };
+
+    ZGClusterSpan(const ZGPointCloud* inCloud, const uint16_t* inBegin, const uint16_t* inEnd,
+                  const ZGClusterStats* inStats) : mCloud(inCloud), mBegin(inBegin), mEnd(inEnd), mStats(inStats) {}
+
+    Iterator begin() const { return {mCloud, mBegin}; }
+
+    Iterator end() const { return {mCloud, mEnd}; }
+
+    int size() const { return static_cast<int>(mEnd - mBegin); }
+
+    const ZGClusterStats& getStats() const { return *mStats; }
+
+private:
+    const ZGPointCloud* mCloud;
+    const uint16_t* mBegin;
+    const uint16_t* mEnd;
+    const ZGClusterStats* mStats;
+};
+
+/**
+ * @brief Clusters of one revolution stored flat: point indices sorted by cluster label, with each cluster's start
+ * offset into them. Statistics for every cluster come from one streaming pass over the labelled cloud. The arrays keep
+ * their capacity between revolutions, and the spans stay valid until the point cloud is refilled.
+ */
+class ZGClusterSet {
+public:
+
+    class Iterator {
+    public:
+        Iterator(const ZGClusterSet* inSet, int inCluster) : mSet(inSet), mCluster(inCluster) {}
+        ZGClusterSpan operator*() const { return (*mSet)[mCluster]; }
+        Iterator& operator++() { ++mCluster; return *this; }
+        bool operator!=(const Iterator& inOther) const { return mCluster != inOther.mCluster; }
+    private:
+        const ZGClusterSet* mSet;
+        int mCluster;
+    };
+
+    /* */
+    ZGClusterSet();
+
+    /* */
+    ~ZGClusterSet();
+
+    /**
+     * @brief Groups the labelled points of the cloud
+     * @param inCloud Points labelled from 1 to inClusterCount, anything else is left out
+     */
+    void build(const ZGPointCloud& inCloud, int inClusterCount);
+
+    /**
+     * @brief Removes every cluster
+     */
+    void clear();
+
+    int size() const;
+
+    ZGClusterSpan operator[](int inCluster) const;
+
+    Iterator begin() const;
+
+    Iterator end() const;
+
+private:
+
+    const ZGPointCloud* mCloud = nullptr;
+    int mCount = 0;
+    std::vector<uint16_t> mPointIndices {};
+    std::vector<uint16_t> mOffsets {};
+    std::vector<ZGClusterStats> mStats {};
+
+};
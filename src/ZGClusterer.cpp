@@ -0,0 +1,179 @@
+//
+// ZGClusterer.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGClusterer.h"
+
+constexpr float ZGClusterer::CLUSTER_DISTANCE;
+constexpr int ZGClusterer::MIN_POINTS_PER_CLUSTER;
+
+ZGClusterer::ZGClusterer() = default;
+
+ZGClusterer::~ZGClusterer() = default;
+
+int ZGClusterer::linkageScan(ZGPointCloud& inCloud, float inRange)
+{
+    mDistanceChecks = 0;
+    mGrid.build(inCloud, CLUSTER_DISTANCE, inRange);
+    mDisjointSet.reset(inCloud.size());
+    const auto radius_squared = CLUSTER_DISTANCE * CLUSTER_DISTANCE;
+
+    // Each pair of cells is visited once, from the cell that comes first
+    const int offsets [4][2] {{1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+    const auto columns = mGrid.getColumns();
+    for (int row = 0; row < columns; row++) {
+        for (int column = 0; column < columns; column++) {
+            auto end = mGrid.getCellEnd(column, row);
+            for (auto a = mGrid.getCellBegin(column, row); a != end; ++a) {
+                auto x = inCloud.getX(*a);
+                auto y = inCloud.getY(*a);
+                auto link = [&](const uint16_t* inBegin, const uint16_t* inEnd) {
+                    mDistanceChecks += inEnd - inBegin;
+                    for (auto b = inBegin; b != inEnd; ++b) {
+                        auto dx = inCloud.getX(*b) - x;
+                        auto dy = inCloud.getY(*b) - y;
+                        if (dx * dx + dy * dy <= radius_squared) {
+                            mDisjointSet.unite(*a, *b);
+                        }
+                    }
+                };
+                link(a + 1, end);
+                for (const auto& offset : offsets) {
+                    auto other_column = column + offset[0];
+                    auto other_row = row + offset[1];
+                    if (other_column < 0 || other_column >= columns || other_row >= columns) {
+                        continue;
+                    }
+                    link(mGrid.getCellBegin(other_column, other_row), mGrid.getCellEnd(other_column, other_row));
+                }
+            }
+        }
+    }
+
+    // Labels and sizes in one pass, a component takes the next label when its first point is reached
+    auto cluster_count = 0;
+    for (int i = 0; i < inCloud.size(); i++) {
+        auto root = mDisjointSet.find(i);
+        if (mDisjointSet.getSize(root) < MIN_POINTS_PER_CLUSTER) {
+            inCloud.setLabel(i, static_cast<int>(ClusterID::NOISE));
+            continue;
+        }
+        if (inCloud.getLabel(root) == static_cast<int>(ClusterID::UNCLASSIFIED)) {
+            inCloud.setLabel(root, ++cluster_count);
+        }
+        inCloud.setLabel(i, inCloud.getLabel(root));
+    }
+    return cluster_count;
+}
+
+int ZGClusterer::dbScan(ZGPointCloud& inCloud, const ZGDensityTable& inDensity, float inRange)
+{
+    mNeighbours.resize(inCloud.size());
+    mGrid.build(inCloud, inDensity.getMaxEpsilon(), inRange);
+
+    int clusterID = 1;
+    for (int i = 0; i < inCloud.size(); i++)
+    {
+        if (inCloud.getLabel(i) != static_cast<int>(ClusterID::UNCLASSIFIED))
+        {
+            continue;
+        }
+        // Stays noise unless a cluster found later reaches it
+        if (!_canBeCore(inCloud, inDensity, i))
+        {
+            inCloud.setLabel(i, static_cast<int>(ClusterID::NOISE));
+            continue;
+        }
+        if (_expandCluster(inCloud, inDensity, i, clusterID) != static_cast<int>(ClusterID::ERROR))
+        {
+            clusterID += 1;
+        }
+    }
+    mDistanceChecks = mGrid.getCandidateCount();
+    return clusterID - 1;
+}
+
+const int64_t &ZGClusterer::getDistanceChecks() const {
+    return mDistanceChecks;
+}
+
+bool ZGClusterer::_canBeCore(const ZGPointCloud& inCloud, const ZGDensityTable& inDensity, int inIndex) const {
+    // Every neighbour lies in the surrounding cells, so fewer points there than the band needs rules it out
+    return mGrid.countNearby(inIndex) >= inDensity.getMinPoints(inCloud.getBand(inIndex));
+}
+
+int ZGClusterer::_findNeighbours(const ZGPointCloud& inCloud, const ZGDensityTable& inDensity, int inIndex,
+                                 int* outIndices) {
+    auto epsilon = inDensity.getEpsilon(inCloud.getBand(inIndex));
+    auto reach = inDensity.getReach(inCloud.getBand(inIndex));
+    auto found = mGrid.findNeighbours(inCloud, inIndex, reach, outIndices);
+    if (reach == epsilon) {
+        // No band in reach has a larger radius, everything found is within this point's own
+        return found;
+    }
+
+    auto x = inCloud.getX(inIndex);
+    auto y = inCloud.getY(inIndex);
+    auto kept = 0;
+    for (int i = 0; i < found; i++) {
+        auto neighbour = outIndices[i];
+        auto radius = std::max(epsilon, inDensity.getEpsilon(inCloud.getBand(neighbour)));
+        auto dx = inCloud.getX(neighbour) - x;
+        auto dy = inCloud.getY(neighbour) - y;
+        if (radius >= reach || dx * dx + dy * dy <= radius * radius) {
+            outIndices[kept++] = neighbour;
+        }
+    }
+    return kept;
+}
+
+int ZGClusterer::_expandCluster(ZGPointCloud& inCloud, const ZGDensityTable& inDensity, int inIndex, int inClusterID)
+{
+    mSeeds.resize(inCloud.size());
+    auto seed_count = _findNeighbours(inCloud, inDensity, inIndex, mSeeds.data());
+
+    if (seed_count < inDensity.getMinPoints(inCloud.getBand(inIndex)))
+    {
+        inCloud.setLabel(inIndex, static_cast<int>(ClusterID::NOISE));
+        return static_cast<int>(ClusterID::ERROR);
+    }
+
+    mSeeds.resize(seed_count);
+    for (auto seed : mSeeds)
+    {
+        inCloud.setLabel(seed, inClusterID);
+    }
+
+    // The queue grows while it is walked, only unclassified points are added so it never exceeds the cloud
+    for (size_t i = 0; i < mSeeds.size(); ++i)
+    {
+        if (mSeeds[i] == inIndex || !_canBeCore(inCloud, inDensity, mSeeds[i]))
+        {
+            continue;
+        }
+        auto neighbour_count = _findNeighbours(inCloud, inDensity, mSeeds[i], mNeighbours.data());
+
+        if (neighbour_count >= inDensity.getMinPoints(inCloud.getBand(mSeeds[i])))
+        {
+            for (int j = 0; j < neighbour_count; j++)
+            {
+                auto neighbour = mNeighbours[j];
+                auto label = static_cast<ClusterID>(inCloud.getLabel(neighbour));
+                if (label == ClusterID::UNCLASSIFIED || label == ClusterID::NOISE)
+                {
+                    if (label == ClusterID::UNCLASSIFIED)
+                    {
+                        mSeeds.push_back(neighbour);
+                    }
+                    inCloud.setLabel(neighbour, inClusterID);
+                }
+            }
+        }
+    }
+
+    return 1;
+}
@@ -0,0 +1,84 @@
+//
+// ZGClusterer.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <vector>
+#include "ZGPointCloud.h"
+#include "ZGSpatialGrid.h"
+#include "ZGDisjointSet.h"
+#include "ZGDensityTable.h"
+
+#pragma once
+
+enum class ScanMode {
+    DISTANCE,   // Single linkage within ZGClusterer::CLUSTER_DISTANCE
+    DBSCAN
+};
+
+/**
+ * @brief Labels the points of one revolution with the cluster they belong to, numbered from 1, or as noise. Holds the
+ * grid, union-find and DBSCAN queues every algorithm works in so none of them allocates once the first revolutions
+ * have been processed.
+ */
+class ZGClusterer {
+public:
+    static constexpr float CLUSTER_DISTANCE = 70.f;    // cm, also how far a tracked object can move per revolution
+    static constexpr int MIN_POINTS_PER_CLUSTER = 10;  // Distance mode only, DBSCAN takes its counts from the density
+
+    /* */
+    ZGClusterer();
+
+    /* */
+    ~ZGClusterer();
+
+    /**
+     * @brief Single linkage clustering for Distance mode. Every pair of points within CLUSTER_DISTANCE is joined,
+     * searching only neighbouring grid cells, and components with enough points become clusters
+     * @param inRange Scan range in cm, for sizing the grid
+     * @return Number of clusters
+     */
+    int linkageScan(ZGPointCloud& inCloud, float inRange);
+
+    /**
+     * @brief Starts a cluster at every unclassified core point. Region queries search the grid cells around a point,
+     * and a point with fewer points in those cells than its band needs cannot be a core point, so it is never searched
+     * around
+     * @param inRange Scan range in cm, for sizing the grid
+     * @return Number of clusters
+     */
+    int dbScan(ZGPointCloud& inCloud, const ZGDensityTable& inDensity, float inRange);
+
+    /**
+     * @return Distance comparisons made by the last scan
+     */
+    const int64_t& getDistanceChecks() const;
+
+private:
+
+    /**
+     * @return True if a point can be a core point, without computing a distance
+     */
+    bool _canBeCore(const ZGPointCloud& inCloud, const ZGDensityTable& inDensity, int inIndex) const;
+
+    /**
+     * @brief Region query with the larger of the two points' radii, so a point reaches another exactly when it is
+     * reached by it
+     * @return Number of neighbours written to outIndices
+     */
+    int _findNeighbours(const ZGPointCloud& inCloud, const ZGDensityTable& inDensity, int inIndex, int* outIndices);
+
+    int _expandCluster(ZGPointCloud& inCloud, const ZGDensityTable& inDensity, int inIndex, int inClusterID);
+
+    int64_t mDistanceChecks = 0;
+
+    std::vector<int> mSeeds {};         // DBSCAN expansion queue, capacity is kept between revolutions
+    std::vector<int> mNeighbours {};    // Result of one radius query, sized to the point cloud
+    ZGSpatialGrid mGrid {};
+    ZGDisjointSet mDisjointSet {};
+
+};
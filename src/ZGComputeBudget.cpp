@@ -0,0 +1,44 @@
+//
+// ZGComputeBudget.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGComputeBudget.h"
+
+ZGComputeBudget::ZGComputeBudget() = default;
+
+ZGComputeBudget::~ZGComputeBudget() = default;
+
+void ZGComputeBudget::update(uint32_t inProcessingTime, uint32_t inRevolutionPeriod) {
+    if (inRevolutionPeriod == 0) {
+        return;
+    }
+    auto load = static_cast<float>(inProcessingTime) / static_cast<float>(inRevolutionPeriod);
+    // The first revolution after a level change starts the average over, the old level's cost no longer applies
+    mLoad = mLoad < 0 ? load : mLoad + (load - mLoad) * LOAD_GAIN;
+
+    auto level = static_cast<int>(mLevel);
+    mRevolutionsOver = mLoad > HIGH_LOAD ? mRevolutionsOver + 1 : 0;
+    mRevolutionsUnder = mLoad < LOW_LOAD ? mRevolutionsUnder + 1 : 0;
+
+    if (mRevolutionsOver >= SHED_REVOLUTIONS && level < LEVELS - 1) {
+        mLevel = static_cast<ComputeLevel>(level + 1);
+        mRevolutionsOver = 0;
+        mLoad = -1;
+    } else if (mRevolutionsUnder >= RESTORE_REVOLUTIONS && level > 0) {
+        mLevel = static_cast<ComputeLevel>(level - 1);
+        mRevolutionsUnder = 0;
+        mLoad = -1;
+    }
+}
+
+const ComputeLevel &ZGComputeBudget::getLevel() const {
+    return mLevel;
+}
+
+int ZGComputeBudget::getLoadPercent() const {
+    return static_cast<int>(std::max(mLoad, 0.f) * 100.f + 0.5f);
+}
@@ -0,0 +1,67 @@
+//
+// ZGComputeBudget.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+
+#pragma once
+
+/**
+ * @brief How much of each revolution the object tracker processes, from full fidelity to the cheapest settings. Each
+ * level keeps the savings of the levels below it.
+ */
+enum class ComputeLevel {
+    FULL,
+    DOWNSAMPLED,    // Points are merged into voxel filter cells as wide as a leg still leaves a cluster
+    SEGMENTED,      // DBSCAN falls back to Distance mode clustering
+    SECTORED        // Only sectors around tracked objects and one rotating sector are clustered
+};
+
+/**
+ * @brief Keeps processing of a revolution well inside the time until the next one, so lidar samples never back up.
+ * Processing time is smoothed as a share of the revolution period. A level is shed as soon as the load stays above
+ * HIGH_LOAD and restored one at a time after it has stayed below LOW_LOAD for a few seconds, the gap between the two
+ * keeps the level from flipping back and forth.
+ */
+class ZGComputeBudget {
+public:
+    static constexpr int LEVELS = 4;
+
+    /* */
+    ZGComputeBudget();
+
+    /* */
+    ~ZGComputeBudget();
+
+    /**
+     * @brief Called once per revolution after it was processed
+     * @param inProcessingTime Microseconds spent processing the revolution
+     * @param inRevolutionPeriod Microseconds since the previous revolution started processing
+     */
+    void update(uint32_t inProcessingTime, uint32_t inRevolutionPeriod);
+
+    const ComputeLevel& getLevel() const;
+
+    /**
+     * @return Smoothed processing time as a percentage of the revolution period
+     */
+    int getLoadPercent() const;
+
+private:
+
+    static constexpr float HIGH_LOAD = 0.4f;
+    static constexpr float LOW_LOAD = 0.15f;
+    static constexpr float LOAD_GAIN = 0.25f;
+    static constexpr int SHED_REVOLUTIONS = 2;
+    static constexpr int RESTORE_REVOLUTIONS = 30;
+
+    ComputeLevel mLevel = ComputeLevel::FULL;
+    float mLoad = -1;       // Share of the revolution period, negative until the first revolution at this level
+    int mRevolutionsOver = 0;
+    int mRevolutionsUnder = 0;
+
+};
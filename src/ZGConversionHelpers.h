@@ -9,6 +9,7 @@
 #include <Arduino.h>
 #include <cmath>
 #include <algorithm>
+#include "ZGFastTrig.h"
 
 #pragma once
 
@@ -22,6 +23,7 @@ struct ZGPoint {
     float x;
     float y;
     int clusterID = 0;
+    uint32_t time = 0; // micros() when the sample was read from the lidar
 };
 
 struct ZGPolarData {
@@ -31,24 +33,15 @@ struct ZGPolarData {
 
 namespace ZGConversionHelpers {
 
-    inline float getDistance(const ZGPoint& inPointA, const ZGPoint& inPointB) {
-        return std::hypot(inPointA.x - inPointB.x, inPointA.y - inPointB.y);
-    }
-
     /**
      * @brief Utility function to convert cartesian data to polar
      * @param inPointXY ZGPoint X/Y data
      * @return ZGPolarData with angles in degrees and distance in centimeters
      */
     inline ZGPolarData cartesianToPolar(ZGPoint inPointXY) {
-        float distance = std::hypot(inPointXY.x, inPointXY.y);
-        float angle_radians = std::atan2(inPointXY.y, inPointXY.x);
-        float angle_degrees = angle_radians * (180.0f / M_PI);
-        if (angle_degrees < 0.0f) {
-            angle_degrees += 360.0f;
-        }
-
-        return ZGPolarData{angle_degrees, distance};
+        auto x = inPointXY.x;
+        auto y = inPointXY.y;
+        return ZGPolarData{ZGFastTrig::atan2Degrees(y, x), std::sqrt(x * x + y * y)};
     }
 
     /**
@@ -58,14 +51,7 @@ namespace ZGConversionHelpers {
      * @return ZGPolarData with angles in degrees and distance in centimeters
      */
     inline ZGPolarData cartesianToPolar(float inX, float inY) {
-        float distance = std::hypot(inX, inY);
-        float angle_radians = std::atan2(inY, inX);
-        float angle_degrees = angle_radians * (180.0f / M_PI);
-        if (angle_degrees < 0.0f) {
-            angle_degrees += 360.0f;
-        }
-
-        return ZGPolarData{angle_degrees, distance};
+        return ZGPolarData{ZGFastTrig::atan2Degrees(inY, inX), std::sqrt(inX * inX + inY * inY)};
     }
 
     /**
@@ -74,10 +60,11 @@ namespace ZGConversionHelpers {
      * @return X/Y point object
      */
     inline ZGPoint polarToCartesian(ZGPolarData inPolarCoords) {
-        float angle_radians = std::fmod(inPolarCoords.angle, 360.0f) * (M_PI / 180.0f);
+        float sine, cosine;
+        ZGFastTrig::sinCosDegrees(inPolarCoords.angle, sine, cosine);
         ZGPoint p {};
-        p.x = inPolarCoords.distance * std::cos(angle_radians);
-        p.y = inPolarCoords.distance * std::sin(angle_radians);
+        p.x = inPolarCoords.distance * cosine;
+        p.y = inPolarCoords.distance * sine;
         return p;
     }
 
@@ -88,73 +75,14 @@ namespace ZGConversionHelpers {
      * @return X/Y point object
      */
     inline ZGPoint polarToCartesian(float inAngleDegrees, float inDistanceCm) {
-        float angle_radians = std::fmod(inAngleDegrees, 360.0f) * (M_PI / 180.0f);
+        float sine, cosine;
+        ZGFastTrig::sinCosDegrees(inAngleDegrees, sine, cosine);
         ZGPoint p {};
-        p.x = inDistanceCm * std::cos(angle_radians);
-        p.y = inDistanceCm * std::sin(angle_radians);
+        p.x = inDistanceCm * cosine;
+        p.y = inDistanceCm * sine;
         return p;
     }
 
-    inline int convertToMajor(int inDegree) {
-        int noteOffset = 0;
-        switch (inDegree) {
-            case 1: // first degree of the scale
-                noteOffset = 0;
-                break;
-            case 2: // second degree of the scale
-                noteOffset = 2;
-                break;
-            case 3: // third degree of the scale
-                noteOffset = 4;
-                break;
-            case 4: // fourth degree of the scale
-                noteOffset = 5;
-                break;
-            case 5: // fifth degree of the scale
-                noteOffset = 7;
-                break;
-            case 6: // sixth degree of the scale
-                noteOffset = 9;
-                break;
-            case 7: // seventh degree of the scale
-                noteOffset = 11;
-                break;
-            default:
-                return 0;
-        }
-        return noteOffset;
-    }
-
-    inline int convertToMinor(int inDegree) {
-        int noteOffset = 0;
-        switch (inDegree) {
-            case 1: // first degree of the scale
-                noteOffset = 0;
-                break;
-            case 2: // second degree of the scale
-                noteOffset = 2;
-                break;
-            case 3: // third degree of the scale
-                noteOffset = 3;
-                break;
-            case 4: // fourth degree of the scale
-                noteOffset = 5;
-                break;
-            case 5: // fifth degree of the scale
-                noteOffset = 7;
-                break;
-            case 6: // sixth degree of the scale
-                noteOffset = 8;
-                break;
-            case 7: // seventh degree of the scale
-                noteOffset = 10;
-                break;
-            default:
-                return 0;
-        }
-        return noteOffset;
-    }
-
     const String noteStrings [12] {
             "C",
             "C#/Db",
@@ -170,11 +98,5 @@ namespace ZGConversionHelpers {
             "B"
     };
 
-    const String scaleStrings [3] {
-            "Chromatic",
-            "M",
-            "m"
-    };
-
 
 }
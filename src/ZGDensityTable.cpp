@@ -0,0 +1,83 @@
+//
+// ZGDensityTable.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGDensityTable.h"
+
+constexpr float ZGDensityTable::MIN_EPSILON;
+constexpr float ZGDensityTable::MAX_EPSILON;
+constexpr int ZGDensityTable::MIN_POINTS;
+constexpr int ZGDensityTable::MAX_POINTS;
+
+ZGDensityTable::ZGDensityTable() {
+    // Until the first revolution is measured assume one sample per bin
+    update(ZGRangeImage::ANGLE_BINS);
+}
+
+ZGDensityTable::~ZGDensityTable() = default;
+
+void ZGDensityTable::update(int inSamplesPerRevolution, float inMinSpacing) {
+    auto samples = std::min(std::max(inSamplesPerRevolution, 1), ZGRangeImage::ANGLE_BINS);
+    auto step = 2.f * static_cast<float>(M_PI) / static_cast<float>(samples);
+    if (mAngularStep != 0 && std::abs(step - mAngularStep) <= 0.1f * mAngularStep && inMinSpacing == mMinSpacing) {
+        return;
+    }
+    mAngularStep = step;
+    mMinSpacing = inMinSpacing;
+    _build();
+}
+
+uint8_t ZGDensityTable::getBand(float inDistance) {
+    return static_cast<uint8_t>(std::min(std::max(static_cast<int>(inDistance * (1.f / BAND_WIDTH)), 0), BANDS - 1));
+}
+
+float ZGDensityTable::getMaxCellSize() {
+    return TARGET_WIDTH / static_cast<float>(MIN_POINTS);
+}
+
+const float &ZGDensityTable::getEpsilon(int inBand) const {
+    return mEpsilons[inBand];
+}
+
+const float &ZGDensityTable::getReach(int inBand) const {
+    return mReaches[inBand];
+}
+
+const int &ZGDensityTable::getMinPoints(int inBand) const {
+    return mMinPoints[inBand];
+}
+
+const float &ZGDensityTable::getMaxEpsilon() const {
+    return mMaxEpsilon;
+}
+
+const int &ZGDensityTable::getMinMinPoints() const {
+    return mMinMinPoints;
+}
+
+void ZGDensityTable::_build() {
+    mMaxEpsilon = MIN_EPSILON;
+    mMinMinPoints = MAX_POINTS;
+    for (int band = 0; band < BANDS; band++) {
+        auto spacing = std::max((static_cast<float>(band) + 0.5f) * BAND_WIDTH * mAngularStep, mMinSpacing);
+        // Three quarters of the samples a leg returns, so a few missing returns still leave core points
+        auto expected = static_cast<int>(std::lround(TARGET_WIDTH / spacing * 0.75f));
+        mMinPoints[band] = std::min(std::max(expected, MIN_POINTS), MAX_POINTS);
+        mEpsilons[band] = std::min(std::max(EPSILON_SPACINGS * spacing, MIN_EPSILON), MAX_EPSILON);
+        mMaxEpsilon = std::max(mMaxEpsilon, mEpsilons[band]);
+        mMinMinPoints = std::min(mMinMinPoints, mMinPoints[band]);
+    }
+
+    // A neighbour is at most the largest radius further out, so only the bands that close can widen the search
+    auto bands_in_reach = static_cast<int>(std::ceil(mMaxEpsilon / BAND_WIDTH));
+    for (int band = 0; band < BANDS; band++) {
+        mReaches[band] = mEpsilons[band];
+        for (int other = band + 1; other <= std::min(band + bands_in_reach, BANDS - 1); other++) {
+            mReaches[band] = std::max(mReaches[band], mEpsilons[other]);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+//
+// ZGDensityTable.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include "ZGRangeImage.h"
+
+#pragma once
+
+/**
+ * @brief DBSCAN neighbourhood radius and core point count per range band. Samples spread further apart with range, so a
+ * person 8 m away returns a handful of points where one at 1 m returns dozens. Both parameters are derived from the
+ * spacing of neighbouring samples at the center of each band and only recomputed when the angular resolution of the
+ * scan changes, so a region query looks them up by the band stored with each point. Two points are neighbours when
+ * they are within the larger of their two radii, so the relation is symmetric across band boundaries and clusters do
+ * not depend on the order points are visited in.
+ */
+class ZGDensityTable {
+public:
+    static constexpr float BAND_WIDTH = 25.f; // cm
+    static constexpr int BANDS = 41;          // Covers the largest selectable range, farther points use the last band
+
+    /* */
+    ZGDensityTable();
+
+    /* */
+    ~ZGDensityTable();
+
+    /**
+     * @brief Rebuilds the table when the resolution differs from the current one by more than 10%
+     * @param inSamplesPerRevolution Measurements made last revolution, with or without a return. The resolution is
+     * never finer than the range image bins since only one sample per bin is clustered
+     * @param inMinSpacing cm between clustered points however close the samples are, the voxel filter cell size
+     */
+    void update(int inSamplesPerRevolution, float inMinSpacing = 0);
+
+    /**
+     * @param inDistance cm from the sensor
+     */
+    static uint8_t getBand(float inDistance);
+
+    /**
+     * @return Widest voxel filter cell that still leaves a leg MIN_POINTS merged points, wider cells merge legs into
+     * noise
+     */
+    static float getMaxCellSize();
+
+    /**
+     * @return Neighbourhood radius in cm
+     */
+    const float& getEpsilon(int inBand) const;
+
+    /**
+     * @return Largest radius of this band and every farther band a neighbour could lie in, the distance a region query
+     * has to search
+     */
+    const float& getReach(int inBand) const;
+
+    /**
+     * @return Points within the radius, the point itself included, that make a point a core point
+     */
+    const int& getMinPoints(int inBand) const;
+
+    /**
+     * @return Largest radius of any band, for sizing grid cells
+     */
+    const float& getMaxEpsilon() const;
+
+    /**
+     * @return Smallest core point count of any band, the fewest points a cluster can have
+     */
+    const int& getMinMinPoints() const;
+
+private:
+
+    static constexpr float TARGET_WIDTH = 12.f;     // cm of one leg, so legs standing apart still form clusters
+    static constexpr float EPSILON_SPACINGS = 4.f;  // The radius bridges three missing samples in a row
+    static constexpr float MIN_EPSILON = 30.f;      // Still joins both legs of someone close by
+    static constexpr float MAX_EPSILON = 60.f;
+    static constexpr int MIN_POINTS = 3;
+    static constexpr int MAX_POINTS = 10;
+
+    void _build();
+
+    float mAngularStep = 0; // radians between samples
+    float mMinSpacing = 0;
+    float mEpsilons[BANDS] {};
+    float mReaches[BANDS] {};
+    int mMinPoints[BANDS] {};
+    float mMaxEpsilon = MIN_EPSILON;
+    int mMinMinPoints = MIN_POINTS;
+
+};
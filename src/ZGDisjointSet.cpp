@@ -0,0 +1,52 @@
+//
+// ZGDisjointSet.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGDisjointSet.h"
+
+ZGDisjointSet::ZGDisjointSet() = default;
+
+ZGDisjointSet::~ZGDisjointSet() = default;
+
+void ZGDisjointSet::reset(int inCount) {
+    for (int i = 0; i < inCount; i++) {
+        mParents[i] = static_cast<uint16_t>(i);
+        mSizes[i] = 1;
+    }
+}
+
+int ZGDisjointSet::find(int inElement) {
+    auto root = inElement;
+    while (mParents[root] != root) {
+        root = mParents[root];
+    }
+    // Point everything on the path straight at the root
+    while (mParents[inElement] != root) {
+        auto next = mParents[inElement];
+        mParents[inElement] = static_cast<uint16_t>(root);
+        inElement = next;
+    }
+    return root;
+}
+
+void ZGDisjointSet::unite(int inElementA, int inElementB) {
+    auto root_a = find(inElementA);
+    auto root_b = find(inElementB);
+    if (root_a == root_b) {
+        return;
+    }
+    // The smaller set hangs below the larger one so trees stay shallow
+    if (mSizes[root_a] < mSizes[root_b]) {
+        std::swap(root_a, root_b);
+    }
+    mParents[root_b] = static_cast<uint16_t>(root_a);
+    mSizes[root_a] += mSizes[root_b];
+}
+
+int ZGDisjointSet::getSize(int inElement) {
+    return mSizes[find(inElement)];
+}
@@ -0,0 +1,54 @@
+//
+// ZGDisjointSet.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include "ZGPointCloud.h"
+
+#pragma once
+
+/**
+ * @brief Union-find over the points of one revolution, used to link every pair of points closer than the cluster
+ * distance into connected components. Sets are joined by size and finds compress the path they walk, so each
+ * operation is close to constant time. The arrays hold one entry per possible point and are never reallocated.
+ */
+class ZGDisjointSet {
+public:
+    static constexpr int MAX_ELEMENTS = ZGPointCloud::MAX_POINTS;
+
+    /* */
+    ZGDisjointSet();
+
+    /* */
+    ~ZGDisjointSet();
+
+    /**
+     * @brief Puts each of the first inCount elements in a set of its own
+     */
+    void reset(int inCount);
+
+    /**
+     * @return The element representing the set inElement belongs to
+     */
+    int find(int inElement);
+
+    /**
+     * @brief Joins the sets of both elements
+     */
+    void unite(int inElementA, int inElementB);
+
+    /**
+     * @return Number of elements in the set of inElement
+     */
+    int getSize(int inElement);
+
+private:
+
+    uint16_t mParents[MAX_ELEMENTS] {};
+    uint16_t mSizes[MAX_ELEMENTS] {};
+
+};
@@ -8,7 +8,7 @@
 
 
 #include "ZGDisplay.h"
-#include "assets/LaunchScreen.c"
+#include "assets/LaunchScreenRLE.c"
 
 ZGDisplay::ZGDisplay(ZGObjectTracker *inObjectTracker, ZGLidar *inLidar)
 {
@@ -20,14 +20,22 @@ ZGDisplay::~ZGDisplay() = default;
 
 void ZGDisplay::initialize()
 {
-    mUI.begin(LCD_CS_PIN, LCD_DC_PIN, TOUCH_CS_PIN, LCD_ORIENTATION_LANDSCAPE_4PIN_LEFT, Inter_12);
-    mUI.lcdDrawImage(0, 0, width, height, LaunchScreen);
+    mUI.begin(LCD_CS_PIN, LCD_DC_PIN, TOUCH_CS_PIN, TOUCH_IRQ_PIN, LCD_ORIENTATION_LANDSCAPE_4PIN_LEFT, Inter_12);
+    mUI.lcdDrawImageRLE(0, 0, width, height, LaunchScreenRLE);
     mUI.setTitleBarColors(aerospace_orange, ghost_white, LCD_BLACK, aerospace_orange);
     mUI.setMenuColors(LCD_BLACK, aerospace_orange, LCD_BLACK, dim_gray, ghost_white);
+    mDebugGlyphs.rasterize(Inter_12, ghost_white, LCD_BLACK, 15);
+    mLatencyGlyphs.rasterize(Inter_9, ghost_white, LCD_BLACK, 14);
+    _buildHeatmapColors();
+    mObjectTracker->getMidiMapping().load(mUI);
+    mObjectTracker->getRegion().load(mUI);
 }
 
 void ZGDisplay::refresh()
 {
+    mLoopStats.addSample(mLoopTimer);
+    mLoopTimer = 0;
+
     mUI.getTouchEvents();
     if(mUI.checkForButtonClicked(mMenuButton)){
         mLidar->pause();
@@ -35,12 +43,20 @@ void ZGDisplay::refresh()
         mLidar->resume();
         mRedraw = true;
     }
-    if (mRefreshTimer >= 100) {
-        if (showDebugData) {
+    // The heatmap changes slowly and takes a full 240x240 write, so it refreshes less often
+    auto refresh_period = mMainView == MainView::HEATMAP ? 1000u : 100u;
+    if (mRefreshTimer >= refresh_period || mRedraw) {
+        elapsedMicros frame_timer = 0;
+        if (mMainView == MainView::DEBUG) {
             printDebugData(mUI, mRedraw);
+        } else if (mMainView == MainView::HEATMAP) {
+            plotHeatmap(mUI, mRedraw);
+        } else if (mMainView == MainView::LATENCY) {
+            printLatencyData(mUI, mRedraw);
         } else {
             plotObjects(mUI, mRedraw);
         }
+        mFrameStats.addSample(frame_timer);
         mRedraw = false;
         mRefreshTimer = 0;
     } else {
@@ -51,16 +67,22 @@ void ZGDisplay::refresh()
 void ZGDisplay::printDebugData(TeensyUserInterface& inUI, bool inRedrawAll)
 {
     if (inRedrawAll){
-        mUI.lcdDrawImage(0, 0, width, height, SettingsBackplate);
+        mUI.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
         mUI.lcdSetCursorXY(247, 6);
         mUI.lcdSetFont(ChakraPetchSemiBold_16);
         mUI.lcdPrintCentered("DEBUG MODE");
         mUI.lcdSetFont(Inter_12);
         inUI.drawButton(mMenuButton);
+        inUI.lcdSetFontColor(ghost_white);
         auto index = 0;
         for (const auto& category : debugCategories) {
-            inUI.lcdSetCursorXY(0, 40 + 18 * index);
+            inUI.lcdSetCursorXY(0, 38 + 15 * index);
             inUI.lcdPrint(category.c_str());
+            // Values are drawn from the glyph cache right after their label
+            auto& field = mDebugFields[index];
+            field.x = inUI.lcdStringWidthInPixels(category.c_str());
+            field.y = 38 + 15 * index;
+            field.invalidate();
             index++;
         }
     }
@@ -70,20 +92,103 @@ void ZGDisplay::printDebugData(TeensyUserInterface& inUI, bool inRedrawAll)
     printDebugValue(mLidar->getTotalLatency(), 2, inUI);
     printDebugValue(mLidar->getProcessingLatency(), 3, inUI);
     printDebugValue(static_cast<int>(mObjectTracker->getObjects().size()), 4, inUI);
+
+    auto touch_calls = inUI.touchScreenReadCount + inUI.touchScreenReadsSkipped;
+    auto touch_skipped = touch_calls == 0 ? 0 : static_cast<int>(static_cast<uint64_t>(inUI.touchScreenReadsSkipped) * 100 / touch_calls);
+    printDebugValue(touch_skipped, 5, inUI);
+
+    printDebugValue(mObjectTracker->getMidiOutput().getBytesPerSecond(), 6, inUI);
+    printDebugValue(mObjectTracker->getMidiOutput().getEventsDroppedPerSecond(), 7, inUI);
+    printDebugValue(mObjectTracker->getMidiClock().getBpm(micros()), 8, inUI);
+    printDebugValue(mObjectTracker->getBackgroundRemovedPercent(), 9, inUI);
+    printDebugValue(mObjectTracker->getClusteringWorkPercent(), 10, inUI);
+    // 0 is full fidelity, see ComputeLevel
+    printDebugValue(static_cast<int>(mObjectTracker->getComputeBudget().getLevel()), 11, inUI);
+    printDebugValue(mObjectTracker->getPointsKeptPercent(), 12, inUI);
 }
 
 void ZGDisplay::printDebugValue(int inValue, int inLine, TeensyUserInterface& inUI)
 {
-    auto cursor_x = inUI.lcdStringWidthInPixels(debugCategories[inLine].c_str());
-    auto cursor_y = inLine * 18 + 40;
-    auto string_cast = static_cast<String>(inValue);
-    auto print_val = string_cast.c_str();
-    auto str_width = inUI.lcdStringWidthInPixels(print_val);
-    auto str_height = 18;
-
-    inUI.lcdSetCursorXY(cursor_x, cursor_y);
-    inUI.lcdDrawFilledRectangle(cursor_x, cursor_y, str_width + 20, str_height, LCD_BLACK);
-    inUI.lcdPrint(print_val);
+    mDebugGlyphs.drawNumber(inUI, mDebugFields[inLine], inValue);
+}
+
+void ZGDisplay::printLatencyData(TeensyUserInterface& inUI, bool inRedrawAll)
+{
+    const int row_height = 46;
+    const int first_row = 56;
+    const int column_spacing = 44;
+
+    if (inRedrawAll){
+        mUI.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
+        mUI.lcdSetCursorXY(247, 6);
+        mUI.lcdSetFont(ChakraPetchSemiBold_16);
+        mUI.lcdPrintCentered("LATENCY");
+        inUI.drawButton(mMenuButton);
+
+        inUI.lcdSetFont(Inter_9);
+        inUI.lcdSetFontColor(cadet_gray);
+        const char* columns [4] {"p50 ms", "p95", "p99", "max"};
+        for (int column = 0; column < 4; column++) {
+            inUI.lcdSetCursorXY(column * column_spacing, 38);
+            inUI.lcdPrint(columns[column]);
+        }
+
+        inUI.lcdSetFontColor(ghost_white);
+        for (int row = 0; row < 4; row++) {
+            inUI.lcdSetCursorXY(0, first_row + row * row_height);
+            inUI.lcdPrint(latencyCategories[row].c_str());
+            for (int column = 0; column < 4; column++) {
+                auto& field = mLatencyFields[row][column];
+                field.x = column * column_spacing;
+                field.y = first_row + row * row_height + 15;
+                field.characters = 5;
+                field.invalidate();
+            }
+        }
+    }
+
+    const ZGLatencyStats* stats [4] {
+            &mLidar->getScanToMidiStats(),
+            &mLidar->getProcessingStats(),
+            &mLoopStats,
+            &mFrameStats
+    };
+
+    for (int row = 0; row < 4; row++) {
+        // Values are shown in tenths of a millisecond
+        auto& fields = mLatencyFields[row];
+        mLatencyGlyphs.drawNumber(inUI, fields[0], static_cast<int>(stats[row]->getPercentile(50) / 100), 1);
+        mLatencyGlyphs.drawNumber(inUI, fields[1], static_cast<int>(stats[row]->getPercentile(95) / 100), 1);
+        mLatencyGlyphs.drawNumber(inUI, fields[2], static_cast<int>(stats[row]->getPercentile(99) / 100), 1);
+        mLatencyGlyphs.drawNumber(inUI, fields[3], static_cast<int>(stats[row]->getMax() / 100), 1);
+        _drawLatencyGraph(inUI, *stats[row], 4 * column_spacing, first_row + row * row_height);
+    }
+}
+
+void ZGDisplay::_drawLatencyGraph(TeensyUserInterface& inUI, const ZGLatencyStats& inStats, int inX, int inY)
+{
+    // Bins outside the graph's range are folded into the first and last bar
+    const auto histogram = inStats.getHistogram();
+    int bars [GRAPH_BARS] {};
+    for (int bin = 0; bin < ZGLatencyStats::BIN_COUNT; bin++) {
+        auto bar = std::max(0, std::min(bin - GRAPH_FIRST_BIN, GRAPH_BARS - 1));
+        bars[bar] += histogram[bin];
+    }
+    auto tallest = 1;
+    for (auto bar : bars) {
+        tallest = std::max(tallest, bar);
+    }
+
+    for (int bar = 0; bar < GRAPH_BARS; bar++) {
+        auto bar_height = bars[bar] == 0 ? 0 : std::max(1, bars[bar] * GRAPH_HEIGHT / tallest);
+        for (int y = 0; y < GRAPH_HEIGHT; y++) {
+            auto color = (GRAPH_HEIGHT - y) <= bar_height ? ubus_green : LCD_BLACK;
+            for (int x = 0; x < GRAPH_BAR_WIDTH; x++) {
+                mGraphPixels[y * GRAPH_WIDTH + bar * GRAPH_BAR_WIDTH + x] = color;
+            }
+        }
+    }
+    inUI.lcdDrawImage(inX, inY, GRAPH_WIDTH, GRAPH_HEIGHT, mGraphPixels);
 }
 
 void ZGDisplay::plotObjects(TeensyUserInterface& inUI, bool inRedrawAll)
@@ -113,9 +218,10 @@ void ZGDisplay::plotObjects(TeensyUserInterface& inUI, bool inRedrawAll)
         if (mObjectTracker->getScaleType() == 0) {
             inUI.lcdPrintRightJustified("Chromatic");
         } else {
-            inUI.lcdPrintRightJustified(ZGConversionHelpers::scaleStrings[mObjectTracker->getScaleType()].c_str());
-            inUI.lcdSetCursorXY(55, 23);
-            inUI.lcdPrintRightJustified(ZGConversionHelpers::noteStrings[mObjectTracker->getRootNote()].c_str());
+            String scale_label = ZGConversionHelpers::noteStrings[mObjectTracker->getRootNote()];
+            scale_label += " ";
+            scale_label += ZGScales::definitions[mObjectTracker->getScaleType()].shortName;
+            inUI.lcdPrintRightJustified(scale_label.c_str());
         }
 
 
@@ -124,21 +230,14 @@ void ZGDisplay::plotObjects(TeensyUserInterface& inUI, bool inRedrawAll)
         inUI.lcdPrint("cm");
 
         inUI.lcdSetCursorXY(67, 215);
-        if (mObjectTracker->getScanMode()) {
-            inUI.lcdPrintRightJustified("DBSCAN");
-        } else {
-            inUI.lcdPrintRightJustified("Distance");
-        }
+        const char* scan_modes [2] {"Distance", "DBSCAN"};
+        inUI.lcdPrintRightJustified(scan_modes[static_cast<int>(mObjectTracker->getScanMode())]);
 
 
     } else { // Erase previous data
-        auto clusters = mDisplayedClusters;
-        for (const auto &cluster: clusters) {
-            auto object_color = LCD_BLACK;
-            for (auto point: cluster) {
-                inUI.lcdDrawFilledCircle(center_x + static_cast<int>(point.x * scale), center_y + static_cast<int>(point.y * scale), 1,
-                                         object_color);
-            }
+        for (const auto& point : mDisplayedPoints) {
+            inUI.lcdDrawFilledCircle(center_x + static_cast<int>(point.x * scale), center_y + static_cast<int>(point.y * scale), 1,
+                                     LCD_BLACK);
         }
         auto objects = mDisplayedObjects;
         for (const auto& object: objects) {
@@ -151,12 +250,15 @@ void ZGDisplay::plotObjects(TeensyUserInterface& inUI, bool inRedrawAll)
     inUI.lcdDrawCircle(center_x, center_y, center_y - 1, dim_gray);
 
     // Paint new data
-    auto clusters = mObjectTracker->getClusters();
+    const auto& clusters = mObjectTracker->getClusters();
     auto index = 0;
+    // Saved for erasing next frame
+    mDisplayedPoints.clear();
     for (const auto& cluster : clusters) {
         auto object_color = colorArray[index];
         for (auto point : cluster) {
             inUI.lcdDrawFilledCircle(center_x + static_cast<int>(point.x * scale), center_y + static_cast<int>(point.y * scale), 1, object_color);
+            mDisplayedPoints.push_back(point);
         }
         index++;
         if (index > 5) {
@@ -169,9 +271,87 @@ void ZGDisplay::plotObjects(TeensyUserInterface& inUI, bool inRedrawAll)
         inUI.lcdDrawFilledCircle(center_x + static_cast<int>(object.getX() * scale), center_y + static_cast<int>(object.getY() * scale), 4, LCD_RED);
         mDisplayedObjects.push_back(object.getPoint());
     }
+}
+
+void ZGDisplay::plotHeatmap(TeensyUserInterface& inUI, bool inRedrawAll)
+{
+    constexpr auto grid_size = ZGOccupancyGrid::GRID_SIZE;
+    constexpr auto cell_size = height / grid_size;
+    constexpr auto plot_size = grid_size * cell_size;
+    constexpr auto origin_x = center_x - plot_size / 2;
+    constexpr auto origin_y = center_y - plot_size / 2;
+
+    if (inRedrawAll) {
+        inUI.lcdClearScreen(LCD_BLACK);
+
+        inUI.lcdSetFont(Inter_9);
+        inUI.lcdSetFontColor(cadet_gray);
+        inUI.lcdSetCursorXY(origin_x - 4, 7);
+        inUI.lcdPrintRightJustified("View");
+
+        inUI.lcdSetFont(Inter_11);
+        inUI.lcdSetFontColor(ghost_white);
+        inUI.lcdSetCursorXY(origin_x - 4, 23);
+        inUI.lcdPrintRightJustified("Heat");
+    }
+
+    // Build one row of cells at a time and send it as a single image
+    const auto& grid = mObjectTracker->getOccupancyGrid();
+    uint16_t row_pixels [plot_size * cell_size];
+    for (int row = 0; row < grid_size; row++) {
+        for (int column = 0; column < grid_size; column++) {
+            auto color = mHeatmapColors[grid.getIntensity(column, row)];
+            for (int x = 0; x < cell_size; x++) {
+                row_pixels[column * cell_size + x] = color;
+            }
+        }
+        for (int y = 1; y < cell_size; y++) {
+            memcpy(&row_pixels[y * plot_size], row_pixels, plot_size * sizeof(uint16_t));
+        }
+        inUI.lcdDrawImage(origin_x, origin_y + row * cell_size, plot_size, cell_size, row_pixels);
+    }
+
+    inUI.lcdDrawFilledCircle(center_x, center_y, 2, aerospace_orange);
+    inUI.drawButton(mMenuButton);
+}
 
-    // Save for next frame
-    mDisplayedClusters = clusters;
+void ZGDisplay::_buildHeatmapColors()
+{
+    // Black -> purple -> orange -> yellow -> white
+    const int stops [5][3] {
+            {0, 0, 0},
+            {120, 20, 140},
+            {250, 80, 0},
+            {255, 220, 0},
+            {255, 255, 255}
+    };
+    for (int i = 0; i < 256; i++) {
+        auto segment = std::min(i / 64, 3);
+        auto t = i - segment * 64;
+        int rgb [3];
+        for (int c = 0; c < 3; c++) {
+            rgb[c] = stops[segment][c] + (stops[segment + 1][c] - stops[segment][c]) * t / 64;
+        }
+        mHeatmapColors[i] = mUI.lcdMakeColor(rgb[0] >> 3, rgb[1] >> 2, rgb[2] >> 3);
+    }
+}
+
+template<typename T>
+void ZGDisplay::_exportCSV(const T& inSource, int inDestination, const char* inFileName)
+{
+    if (inDestination == 1) {
+        inSource.writeCSV(Serial);
+    } else if (inDestination == 2) {
+        if (!SD.begin(BUILTIN_SDCARD)) {
+            return;
+        }
+        SD.remove(inFileName);
+        auto file = SD.open(inFileName, FILE_WRITE);
+        if (file) {
+            inSource.writeCSV(file);
+            file.close();
+        }
+    }
 }
 
 float ZGDisplay::_getScaleFactor() {
@@ -180,15 +360,16 @@ float ZGDisplay::_getScaleFactor() {
 
 void ZGDisplay::showMainMenu(TeensyUserInterface& ui) {
     auto redraw = true;
-    BUTTON_IMAGE mScanButton {"SCAN", SelectButtonDefault, SelectButtonPressed, 82, 80, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
-    BUTTON_IMAGE mMidiButton {"MIDI",SelectButtonDefault, SelectButtonPressed, 237, 80, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
-    BUTTON_IMAGE mDisplayButton {"DISPLAY",SelectButtonDefault, SelectButtonPressed, 82, 162, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
-    BUTTON_IMAGE mAboutButton {"ABOUT",SelectButtonDefault, SelectButtonPressed, 237, 162, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
+    BUTTON_IMAGE mScanButton {"SCAN", SelectButtonDefaultRLE, SelectButtonPressedRLE, 82, 70, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
+    BUTTON_IMAGE mMidiButton {"MIDI",SelectButtonDefaultRLE, SelectButtonPressedRLE, 237, 70, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
+    BUTTON_IMAGE mDisplayButton {"DISPLAY",SelectButtonDefaultRLE, SelectButtonPressedRLE, 82, 135, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
+    BUTTON_IMAGE mMappingButton {"MAPPING",SelectButtonDefaultRLE, SelectButtonPressedRLE, 237, 135, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
+    BUTTON_IMAGE mAboutButton {"ABOUT",SelectButtonDefaultRLE, SelectButtonPressedRLE, 237, 200, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
 
     while(true)
     {
         if (redraw){
-            ui.lcdDrawImage(0, 0, width, height, SettingsBackplate);
+            ui.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
             ui.lcdSetCursorXY(247, 6);
             ui.lcdSetFont(ChakraPetchSemiBold_16);
             ui.lcdPrintCentered("SETTINGS");
@@ -196,6 +377,7 @@ void ZGDisplay::showMainMenu(TeensyUserInterface& ui) {
             ui.drawButton(mScanButton);
             ui.drawButton(mMidiButton);
             ui.drawButton(mDisplayButton);
+            ui.drawButton(mMappingButton);
             ui.drawButton(mAboutButton);
             redraw = false;
         }
@@ -220,6 +402,11 @@ void ZGDisplay::showMainMenu(TeensyUserInterface& ui) {
             redraw = true;
         }
 
+        if (ui.checkForButtonClicked(mMappingButton)) {
+            showMapping();
+            redraw = true;
+        }
+
         if (ui.checkForButtonClicked(mAboutButton)) {
             showAbout(ui);
             redraw = true;
@@ -228,7 +415,7 @@ void ZGDisplay::showMainMenu(TeensyUserInterface& ui) {
 }
 
 void ZGDisplay::showAbout(TeensyUserInterface &ui) {
-    ui.lcdDrawImage(0, 0, width, height, SettingsBackplate);
+    ui.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
     ui.lcdSetCursorXY(247, 6);
     ui.lcdSetFont(ChakraPetchSemiBold_16);
     ui.lcdPrintCentered("ABOUT");
@@ -276,7 +463,7 @@ void ZGDisplay::showAbout(TeensyUserInterface &ui) {
 
 void ZGDisplay::showScan()
 {
-    mUI.lcdDrawImage(0, 0, width, height, SettingsBackplate);
+    mUI.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
     mUI.lcdSetCursorXY(247, 6);
     mUI.lcdSetFont(ChakraPetchSemiBold_16);
     mUI.lcdPrintCentered("SCAN");
@@ -284,7 +471,7 @@ void ZGDisplay::showScan()
     //
     // set the size and initial value of the number box
     //
-    const int numberBoxWidth = 200;
+    const int numberBoxWidth = 144;
     const int numberBoxAndButtonsHeight = 30;
 
     //
@@ -297,25 +484,82 @@ void ZGDisplay::showScan()
     range_box.minimumValue  = 50;
     range_box.maximumValue  = 1000;
     range_box.stepAmount    = 50;
-    range_box.centerX       = width / 2;
-    range_box.centerY       = height / 2 - 40;
+    range_box.centerX       = 82;
+    range_box.centerY       = height / 2 - 56;
     range_box.width         = numberBoxWidth;
     range_box.height        = numberBoxAndButtonsHeight;
     mUI.drawNumberBox(range_box);
 
+    // Learn clears the background and learns it again over the next few seconds, the area should be empty meanwhile
+    SELECTION_BOX background_box;
+    background_box.labelText = "Background";
+    background_box.value = mObjectTracker->getBackgroundModel().isEnabled();
+    background_box.choice0Text = "Keep";
+    background_box.choice1Text = "Drop";
+    background_box.choice2Text = "Learn";
+    background_box.choice3Text = "";
+    background_box.centerX = 237;
+    background_box.centerY = height / 2 - 56;
+    background_box.width = 144;
+    background_box.height = 30;
+    mUI.drawSelectionBox(background_box);
+
     SELECTION_BOX mode_box;
-    mode_box.labelText = "Clustering Algorithm Mode";
-    mode_box.value = mObjectTracker->getScanMode();	 // set default value, 0 is 1st choice
+    mode_box.labelText = "Clustering";
+    mode_box.value = static_cast<int>(mObjectTracker->getScanMode());	 // set default value, 0 is 1st choice
     mode_box.choice0Text = "Distance";
     mode_box.choice1Text = "DBSCAN";
     mode_box.choice2Text = "";
     mode_box.choice3Text = "";		// set unused choices to: ""
-    mode_box.centerX = width/2;
-    mode_box.centerY = height / 2 + 30;
-    mode_box.width = 250;
+    mode_box.centerX = 82;
+    mode_box.centerY = height / 2 - 8;
+    mode_box.width = 144;
     mode_box.height = 30;
     mUI.drawSelectionBox(mode_box);		       // display the Selection Box
 
+    // Edit opens the polygon editor once OK is pressed
+    SELECTION_BOX region_box;
+    region_box.labelText = "Region";
+    region_box.value = mObjectTracker->getRegion().isEnabled();
+    region_box.choice0Text = "Circle";
+    region_box.choice1Text = "Shape";
+    region_box.choice2Text = "Edit";
+    region_box.choice3Text = "";
+    region_box.centerX = 237;
+    region_box.centerY = height / 2 - 8;
+    region_box.width = 144;
+    region_box.height = 30;
+    mUI.drawSelectionBox(region_box);
+
+    SELECTION_BOX steal_box;
+    steal_box.labelText = "Out Of Voices Drop";
+    steal_box.value = static_cast<int>(mObjectTracker->getStealPolicy());
+    steal_box.choice0Text = "Oldest";
+    steal_box.choice1Text = "Quietest";
+    steal_box.choice2Text = "Farthest";
+    steal_box.choice3Text = "";
+    steal_box.centerX = 82;
+    steal_box.centerY = height / 2 + 40;
+    steal_box.width = 144;
+    steal_box.height = 30;
+    mUI.drawSelectionBox(steal_box);
+
+    // Cell sizes in cm the voxel filter merges points into before clustering
+    const float voxel_sizes [4] {0, 2, 4, 8};
+    SELECTION_BOX voxel_box;
+    voxel_box.labelText = "Downsample";
+    auto voxel_size = std::find(voxel_sizes, voxel_sizes + 4, mObjectTracker->getVoxelSize());
+    voxel_box.value = static_cast<int>(voxel_size - voxel_sizes);
+    voxel_box.choice0Text = "Off";
+    voxel_box.choice1Text = "2cm";
+    voxel_box.choice2Text = "4cm";
+    voxel_box.choice3Text = "8cm";
+    voxel_box.centerX = 237;
+    voxel_box.centerY = height / 2 + 40;
+    voxel_box.width = 144;
+    voxel_box.height = 30;
+    mUI.drawSelectionBox(voxel_box);
+
 
     mUI.drawButton(mOkButton);
 
@@ -330,7 +574,11 @@ void ZGDisplay::showScan()
         mUI.getTouchEvents();
 
         mUI.checkForNumberBoxTouched(range_box);
+        mUI.checkForSelectionBoxTouched(background_box);
         mUI.checkForSelectionBoxTouched(mode_box);
+        mUI.checkForSelectionBoxTouched(region_box);
+        mUI.checkForSelectionBoxTouched(steal_box);
+        mUI.checkForSelectionBoxTouched(voxel_box);
 
         //
         // check for touch events on the "OK" button
@@ -341,7 +589,21 @@ void ZGDisplay::showScan()
             // user OK pressed, get the value from the Number Box and display it
             //
             mObjectTracker->setMaxDistance(static_cast<float>(range_box.value));
-            mObjectTracker->setScanMode(mode_box.value);
+            mObjectTracker->setScanMode(static_cast<ScanMode>(mode_box.value));
+            mObjectTracker->setStealPolicy(static_cast<VoiceStealPolicy>(steal_box.value));
+            mObjectTracker->setVoxelSize(voxel_sizes[voxel_box.value]);
+            if (background_box.value == 2) {
+                mObjectTracker->calibrateBackground();
+            } else {
+                mObjectTracker->setBackgroundRemoval(background_box.value == 1);
+            }
+            auto& region = mObjectTracker->getRegion();
+            if (region_box.value == 2) {
+                showRegion();
+            } else if (region.isEnabled() != (region_box.value == 1)) {
+                region.setEnabled(region_box.value == 1);
+                region.save(mUI);
+            }
             return;
         }
 
@@ -355,24 +617,50 @@ void ZGDisplay::showScan()
 
 void ZGDisplay::showDisplay()
 {
-    mUI.lcdDrawImage(0, 0, width, height, SettingsBackplate);
+    mUI.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
     mUI.lcdSetCursorXY(247, 6);
     mUI.lcdSetFont(ChakraPetchSemiBold_16);
     mUI.lcdPrintCentered("DISPLAY");
 
     SELECTION_BOX mode_box;
     mode_box.labelText = "Main View";
-    mode_box.value = showDebugData;	 // set default value, 0 is 1st choice
+    mode_box.value = static_cast<int>(mMainView);	 // set default value, 0 is 1st choice
     mode_box.choice0Text = "Plot";
     mode_box.choice1Text = "Debug";
-    mode_box.choice2Text = "";
-    mode_box.choice3Text = "";		// set unused choices to: ""
+    mode_box.choice2Text = "Heatmap";
+    mode_box.choice3Text = "Latency";
     mode_box.centerX = width/2;
-    mode_box.centerY = height / 2;
+    mode_box.centerY = height / 2 - 56;
     mode_box.width = 250;
     mode_box.height = 30;
     mUI.drawSelectionBox(mode_box);		       // display the Selection Box
 
+    SELECTION_BOX export_box;
+    export_box.labelText = "Export Heatmap";
+    export_box.value = 0;
+    export_box.choice0Text = "No";
+    export_box.choice1Text = "Serial";
+    export_box.choice2Text = "SD Card";
+    export_box.choice3Text = "";
+    export_box.centerX = width/2;
+    export_box.centerY = height / 2 - 8;
+    export_box.width = 250;
+    export_box.height = 30;
+    mUI.drawSelectionBox(export_box);
+
+    SELECTION_BOX trace_box;
+    trace_box.labelText = "Export MIDI Trace";
+    trace_box.value = 0;
+    trace_box.choice0Text = "No";
+    trace_box.choice1Text = "Serial";
+    trace_box.choice2Text = "SD Card";
+    trace_box.choice3Text = "";
+    trace_box.centerX = width/2;
+    trace_box.centerY = height / 2 + 40;
+    trace_box.width = 250;
+    trace_box.height = 30;
+    mUI.drawSelectionBox(trace_box);
+
 
     mUI.drawButton(mOkButton);
 
@@ -387,6 +675,8 @@ void ZGDisplay::showDisplay()
         mUI.getTouchEvents();
 
         mUI.checkForSelectionBoxTouched(mode_box);
+        mUI.checkForSelectionBoxTouched(export_box);
+        mUI.checkForSelectionBoxTouched(trace_box);
 
         //
         // check for touch events on the "OK" button
@@ -396,7 +686,9 @@ void ZGDisplay::showDisplay()
             //
             // user OK pressed, get the value from the Number Box and display it
             //
-            showDebugData = mode_box.value;
+            mMainView = static_cast<MainView>(mode_box.value);
+            _exportCSV(mObjectTracker->getOccupancyGrid(), export_box.value, "occupancy.csv");
+            _exportCSV(mObjectTracker->getMidiOutput().getTrace(), trace_box.value, "midi_trace.csv");
             return;
         }
 
@@ -410,7 +702,7 @@ void ZGDisplay::showDisplay()
 
 void ZGDisplay::showMidi()
 {
-    mUI.lcdDrawImage(0, 0, width, height, SettingsBackplate);
+    mUI.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
     mUI.lcdSetCursorXY(247, 6);
     mUI.lcdSetFont(ChakraPetchSemiBold_16);
     mUI.lcdPrintCentered("MIDI");
@@ -418,7 +710,6 @@ void ZGDisplay::showMidi()
     //
     // set the size and initial value of the number box
     //
-    const int numberBoxWidth = 200;
     const int numberBoxAndButtonsHeight = 30;
 
     //
@@ -431,26 +722,97 @@ void ZGDisplay::showMidi()
     note_box.minimumValue  = 0;
     note_box.maximumValue  = 11;
     note_box.stepAmount    = 1;
-    note_box.centerX       = width / 2;
-    note_box.centerY       = height / 2 - 40;
-    note_box.width         = numberBoxWidth;
+    note_box.centerX       = 82;
+    note_box.centerY       = height / 2 - 56;
+    note_box.width         = 144;
     note_box.height        = numberBoxAndButtonsHeight;
     note_box.isNoteBox     = true;
     mUI.drawNumberBox(note_box);
 
+    NUMBER_BOX octave_box;
+    octave_box.labelText     = "Octaves";
+    octave_box.value         = mObjectTracker->getOctaves();
+    octave_box.minimumValue  = 1;
+    octave_box.maximumValue  = ZGScaleQuantizer::MAX_OCTAVES;
+    octave_box.stepAmount    = 1;
+    octave_box.centerX       = 237;
+    octave_box.centerY       = height / 2 - 56;
+    octave_box.width         = 144;
+    octave_box.height        = numberBoxAndButtonsHeight;
+    mUI.drawNumberBox(octave_box);
+
+    const char* scale_names [ZGScales::COUNT];
+    for (int i = 0; i < ZGScales::COUNT; i++) {
+        scale_names[i] = ZGScales::definitions[i].name;
+    }
+
     NUMBER_BOX scale_box;
     scale_box.labelText     = "Scale Type";
     scale_box.value         = mObjectTracker->getScaleType();
     scale_box.minimumValue  = 0;
-    scale_box.maximumValue  = 2;
+    scale_box.maximumValue  = ZGScales::COUNT - 1;
     scale_box.stepAmount    = 1;
-    scale_box.centerX       = width / 2;
-    scale_box.centerY       = height / 2 + 30;
-    scale_box.width         = numberBoxWidth;
+    scale_box.centerX       = 82;
+    scale_box.centerY       = height / 2 - 8;
+    scale_box.width         = 144;
     scale_box.height        = numberBoxAndButtonsHeight;
-    scale_box.isScaleBox     = true;
+    scale_box.valueLabels   = scale_names;
     mUI.drawNumberBox(scale_box);
 
+    // Grid spacing in MIDI clock ticks, 24 per quarter note
+    const int grid_ticks [7] {0, 24, 12, 8, 6, 4, 3};
+    const char* const grid_names [7] {"Off", "1/4", "1/8", "1/8T", "1/16", "1/16T", "1/32"};
+    NUMBER_BOX grid_box;
+    grid_box.labelText     = "Clock Grid";
+    grid_box.value         = 0;
+    for (int i = 0; i < 7; i++) {
+        if (grid_ticks[i] == mObjectTracker->getQuantizeGrid()) {
+            grid_box.value = i;
+        }
+    }
+    grid_box.minimumValue  = 0;
+    grid_box.maximumValue  = 6;
+    grid_box.stepAmount    = 1;
+    grid_box.centerX       = 237;
+    grid_box.centerY       = height / 2 - 8;
+    grid_box.width         = 144;
+    grid_box.height        = numberBoxAndButtonsHeight;
+    grid_box.valueLabels   = grid_names;
+    mUI.drawNumberBox(grid_box);
+
+    // Off sends standard MIDI, the other choices send MPE with that pitch bend range in semitones
+    const int bend_ranges [4] {0, 2, 12, 48};
+    SELECTION_BOX expression_box;
+    expression_box.labelText = "Bend Range";
+    expression_box.value = 0;
+    for (int i = 0; i < 4; i++) {
+        if (bend_ranges[i] == mObjectTracker->getPitchBendRange()) {
+            expression_box.value = i;
+        }
+    }
+    expression_box.choice0Text = "Off";
+    expression_box.choice1Text = "2";
+    expression_box.choice2Text = "12";
+    expression_box.choice3Text = "48";
+    expression_box.centerX = 82;
+    expression_box.centerY = height / 2 + 40;
+    expression_box.width = 144;
+    expression_box.height = 30;
+    mUI.drawSelectionBox(expression_box);
+
+    SELECTION_BOX zone_box;
+    zone_box.labelText = "MPE Zone";
+    zone_box.value = static_cast<int>(mObjectTracker->getMpeZone());
+    zone_box.choice0Text = "Lower";
+    zone_box.choice1Text = "Upper";
+    zone_box.choice2Text = "";
+    zone_box.choice3Text = "";
+    zone_box.centerX = 237;
+    zone_box.centerY = height / 2 + 40;
+    zone_box.width = 144;
+    zone_box.height = 30;
+    mUI.drawSelectionBox(zone_box);
+
 
     mUI.drawButton(mOkButton);
 
@@ -465,7 +827,11 @@ void ZGDisplay::showMidi()
         mUI.getTouchEvents();
 
         mUI.checkForNumberBoxTouched(note_box);
+        mUI.checkForNumberBoxTouched(octave_box);
         mUI.checkForNumberBoxTouched(scale_box);
+        mUI.checkForNumberBoxTouched(grid_box);
+        mUI.checkForSelectionBoxTouched(expression_box);
+        mUI.checkForSelectionBoxTouched(zone_box);
 
         //
         // check for touch events on the "OK" button
@@ -474,6 +840,14 @@ void ZGDisplay::showMidi()
         {
             mObjectTracker->setRootNote(note_box.value);
             mObjectTracker->setScaleType(scale_box.value);
+            mObjectTracker->setOctaves(octave_box.value);
+            mObjectTracker->setQuantizeGrid(grid_ticks[grid_box.value]);
+            if (static_cast<MpeZone>(zone_box.value) != mObjectTracker->getMpeZone()) {
+                mObjectTracker->setMpeZone(static_cast<MpeZone>(zone_box.value));
+            }
+            if (bend_ranges[expression_box.value] != mObjectTracker->getPitchBendRange()) {
+                mObjectTracker->setPitchBendRange(bend_ranges[expression_box.value]);
+            }
             //
             // user OK pressed, get the value from the Number Box and display it
             //
@@ -488,4 +862,285 @@ void ZGDisplay::showMidi()
     }
 }
 
+void ZGDisplay::showMapping()
+{
+    mUI.lcdDrawImageRLE(0, 0, width, height, SettingsBackplateRLE);
+    mUI.lcdSetCursorXY(247, 6);
+    mUI.lcdSetFont(ChakraPetchSemiBold_16);
+    mUI.lcdPrintCentered("MAPPING");
+
+    struct DestinationPreset {
+        const char* name;
+        MidiDestination destination;
+        int controller;
+    };
+    const DestinationPreset presets [] {
+            {"Off", MidiDestination::OFF, 0},
+            {"Note", MidiDestination::NOTE, 0},
+            {"Pitch Bend", MidiDestination::PITCH_BEND, 0},
+            {"Pressure", MidiDestination::PRESSURE, 0},
+            {"CC 1 Mod", MidiDestination::CONTROL_CHANGE, 1},
+            {"CC 1 Mod 14b", MidiDestination::CONTROL_CHANGE_14, 1},
+            {"CC 2 Breath", MidiDestination::CONTROL_CHANGE, 2},
+            {"CC 7 Volume", MidiDestination::CONTROL_CHANGE, 7},
+            {"CC 10 Pan", MidiDestination::CONTROL_CHANGE, 10},
+            {"CC 11 Expr", MidiDestination::CONTROL_CHANGE, 11},
+            {"CC 71 Reso", MidiDestination::CONTROL_CHANGE, 71},
+            {"CC 74 Timbre", MidiDestination::CONTROL_CHANGE, 74}
+    };
+    const int preset_count = sizeof(presets) / sizeof(presets[0]);
+
+    // Routes loaded from EEPROM can use any controller, those show as Custom and are left alone
+    const char* destination_names [preset_count + 1];
+    for (int i = 0; i < preset_count; i++) {
+        destination_names[i] = presets[i].name;
+    }
+    destination_names[preset_count] = "Custom";
+
+    const int smoothing_steps [3] {0, 2, 4};
+
+    // Edits are made on a copy and only applied and stored when OK is pressed
+    auto& mapping = mObjectTracker->getMidiMapping();
+    ZGMidiRoute routes [ZGMidiMapping::MAX_ROUTES];
+    for (int i = 0; i < ZGMidiMapping::MAX_ROUTES; i++) {
+        routes[i] = mapping.getRoute(i);
+    }
+
+    NUMBER_BOX route_box;
+    route_box.labelText     = "Route";
+    route_box.value         = 1;
+    route_box.minimumValue  = 1;
+    route_box.maximumValue  = ZGMidiMapping::MAX_ROUTES;
+    route_box.stepAmount    = 1;
+    route_box.centerX       = 50;
+    route_box.centerY       = height / 2 - 56;
+    route_box.width         = 90;
+    route_box.height        = 30;
+
+    SELECTION_BOX curve_box;
+    curve_box.labelText = "Curve";
+    curve_box.choice0Text = "Lin";
+    curve_box.choice1Text = "Exp";
+    curve_box.choice2Text = "Log";
+    curve_box.choice3Text = "Inv";
+    curve_box.centerX = 160;
+    curve_box.centerY = height / 2 - 56;
+    curve_box.width = 120;
+    curve_box.height = 30;
+
+    SELECTION_BOX smoothing_box;
+    smoothing_box.labelText = "Smooth";
+    smoothing_box.choice0Text = "Off";
+    smoothing_box.choice1Text = "Lo";
+    smoothing_box.choice2Text = "Hi";
+    smoothing_box.choice3Text = "";
+    smoothing_box.centerX = 270;
+    smoothing_box.centerY = height / 2 - 56;
+    smoothing_box.width = 90;
+    smoothing_box.height = 30;
+
+    NUMBER_BOX feature_box;
+    feature_box.labelText     = "Feature";
+    feature_box.minimumValue  = 0;
+    feature_box.maximumValue  = ZGMidiMapping::FEATURE_COUNT - 1;
+    feature_box.stepAmount    = 1;
+    feature_box.centerX       = width / 2;
+    feature_box.centerY       = height / 2 - 8;
+    feature_box.width         = 250;
+    feature_box.height        = 30;
+    feature_box.valueLabels   = ZGMidiMapping::featureNames;
+
+    NUMBER_BOX destination_box;
+    destination_box.labelText     = "Destination";
+    destination_box.minimumValue  = 0;
+    destination_box.maximumValue  = preset_count;
+    destination_box.stepAmount    = 1;
+    destination_box.centerX       = width / 2;
+    destination_box.centerY       = height / 2 + 40;
+    destination_box.width         = 250;
+    destination_box.height        = 30;
+    destination_box.valueLabels   = destination_names;
+
+    auto draw_route = [&](const ZGMidiRoute& inRoute) {
+        curve_box.value = static_cast<int>(inRoute.curve);
+        smoothing_box.value = inRoute.smoothing == 0 ? 0 : (inRoute.smoothing <= 2 ? 1 : 2);
+        feature_box.value = static_cast<int>(inRoute.feature);
+        destination_box.value = preset_count;
+        for (int i = 0; i < preset_count; i++) {
+            auto uses_controller = presets[i].destination == MidiDestination::CONTROL_CHANGE ||
+                    presets[i].destination == MidiDestination::CONTROL_CHANGE_14;
+            if (presets[i].destination == inRoute.destination &&
+                (!uses_controller || presets[i].controller == inRoute.controller)) {
+                destination_box.value = i;
+                break;
+            }
+        }
+        mUI.drawSelectionBox(curve_box);
+        mUI.drawSelectionBox(smoothing_box);
+        mUI.drawNumberBox(feature_box);
+        mUI.drawNumberBox(destination_box);
+    };
+
+    mUI.drawNumberBox(route_box);
+    draw_route(routes[0]);
+
+    mUI.drawButton(mOkButton);
+
+    mUI.drawButton(mCancelButton);
+
+
+    //
+    // process touch events
+    //
+    while(true)
+    {
+        mUI.getTouchEvents();
+
+        auto& route = routes[route_box.value - 1];
+
+        if (mUI.checkForNumberBoxTouched(route_box)) {
+            draw_route(routes[route_box.value - 1]);
+        }
+
+        if (mUI.checkForSelectionBoxTouched(curve_box)) {
+            route.curve = static_cast<MidiCurve>(curve_box.value);
+        }
+
+        if (mUI.checkForSelectionBoxTouched(smoothing_box)) {
+            route.smoothing = smoothing_steps[smoothing_box.value];
+        }
+
+        // Changing the feature or destination resets the matching side of the range to its natural span
+        if (mUI.checkForNumberBoxTouched(feature_box)) {
+            auto defaults = ZGMidiMapping::makeRoute(static_cast<MidiFeature>(feature_box.value), route.destination);
+            route.feature = defaults.feature;
+            route.inputMin = defaults.inputMin;
+            route.inputMax = defaults.inputMax;
+        }
+
+        if (mUI.checkForNumberBoxTouched(destination_box) && destination_box.value < preset_count) {
+            const auto& preset = presets[destination_box.value];
+            auto defaults = ZGMidiMapping::makeRoute(route.feature, preset.destination, preset.controller);
+            route.destination = defaults.destination;
+            route.controller = defaults.controller;
+            route.outputMin = defaults.outputMin;
+            route.outputMax = defaults.outputMax;
+        }
+
+        //
+        // check for touch events on the "OK" button
+        //
+        if (mUI.checkForButtonClicked(mOkButton))
+        {
+            for (int i = 0; i < ZGMidiMapping::MAX_ROUTES; i++) {
+                mapping.setRoute(i, routes[i]);
+            }
+            mapping.save(mUI);
+            return;
+        }
+
+        //
+        // check for touch events on the "Cancel" button
+        //
+        if (mUI.checkForButtonClicked(mCancelButton))
+            return;
+    }
+}
+
+void ZGDisplay::showRegion()
+{
+    auto& region = mObjectTracker->getRegion();
+    auto scale = _getScaleFactor();
+
+    // Edits are made on a copy and only applied and stored when OK is pressed
+    ZGRegionPolygon polygons [ZGRegionOfInterest::MAX_POLYGONS];
+    for (int i = 0; i < ZGRegionOfInterest::MAX_POLYGONS; i++) {
+        polygons[i] = region.getPolygon(i);
+    }
+    auto selected = 0;
+
+    // The plot circle fills the middle of the screen, buttons go down both sides
+    BUTTON_EXTENDED polygon_buttons [ZGRegionOfInterest::MAX_POLYGONS] {
+            {"IN", 20, 40, 38, 32, LCD_BLACK, dim_gray, cadet_gray, ghost_white, Inter_9},
+            {"EX 1", 20, 80, 38, 32, LCD_BLACK, dim_gray, cadet_gray, ghost_white, Inter_9},
+            {"EX 2", 20, 120, 38, 32, LCD_BLACK, dim_gray, cadet_gray, ghost_white, Inter_9}
+    };
+    BUTTON_EXTENDED undo_button {"UNDO", 300, 40, 38, 32, LCD_BLACK, dim_gray, cadet_gray, ghost_white, Inter_9};
+    BUTTON_EXTENDED clear_button {"CLR", 300, 80, 38, 32, LCD_BLACK, dim_gray, cadet_gray, ghost_white, Inter_9};
+    BUTTON_EXTENDED ok_button {"OK", 300, 160, 38, 32, LCD_BLACK, dim_gray, cadet_gray, ghost_white, Inter_9};
+    BUTTON_EXTENDED cancel_button {"ESC", 300, 200, 38, 32, LCD_BLACK, dim_gray, cadet_gray, ghost_white, Inter_9};
+
+    auto to_screen_x = [&](int16_t inX) { return center_x + static_cast<int>(inX * scale); };
+    auto to_screen_y = [&](int16_t inY) { return center_y + static_cast<int>(inY * scale); };
 
+    auto redraw = true;
+    while(true)
+    {
+        if (redraw) {
+            mUI.lcdClearScreen(LCD_BLACK);
+            mUI.lcdDrawCircle(center_x, center_y, center_y - 1, dim_gray);
+            mUI.lcdDrawFilledCircle(center_x, center_y, 2, aerospace_orange);
+            for (int i = 0; i < ZGRegionOfInterest::MAX_POLYGONS; i++) {
+                const auto& polygon = polygons[i];
+                auto color = i == 0 ? ubus_green : LCD_RED;
+                for (int v = 0; v < polygon.count; v++) {
+                    const auto& a = polygon.vertices[v];
+                    mUI.lcdDrawFilledCircle(to_screen_x(a.x), to_screen_y(a.y), i == selected ? 3 : 2, color);
+                    // Open while being drawn, closed once it is a usable polygon
+                    if (v + 1 < polygon.count || polygon.count >= 3) {
+                        const auto& b = polygon.vertices[(v + 1) % polygon.count];
+                        mUI.lcdDrawLine(to_screen_x(a.x), to_screen_y(a.y), to_screen_x(b.x), to_screen_y(b.y), color);
+                    }
+                }
+                mUI.drawButton(polygon_buttons[i], i == selected);
+            }
+            mUI.drawButton(undo_button);
+            mUI.drawButton(clear_button);
+            mUI.drawButton(ok_button);
+            mUI.drawButton(cancel_button);
+            redraw = false;
+        }
+
+        mUI.getTouchEvents();
+
+        for (int i = 0; i < ZGRegionOfInterest::MAX_POLYGONS; i++) {
+            if (mUI.checkForButtonClicked(polygon_buttons[i])) {
+                selected = i;
+                redraw = true;
+            }
+        }
+
+        auto& polygon = polygons[selected];
+        if (mUI.checkForButtonClicked(undo_button) && polygon.count > 0) {
+            polygon.count--;
+            redraw = true;
+        }
+
+        if (mUI.checkForButtonClicked(clear_button)) {
+            polygon.count = 0;
+            redraw = true;
+        }
+
+        // Touching inside the plot circle adds a vertex to the selected polygon
+        if (mUI.checkForTouchEventInRect(TOUCH_PUSHED_EVENT, center_x - center_y, 0, center_x + center_y, height - 1) &&
+            polygon.count < ZGRegionPolygon::MAX_VERTICES) {
+            auto x = static_cast<float>(mUI.touchEventX - center_x) / scale;
+            auto y = static_cast<float>(mUI.touchEventY - center_y) / scale;
+            polygon.vertices[polygon.count++] = ZGRegionVertex{static_cast<int16_t>(x), static_cast<int16_t>(y)};
+            redraw = true;
+        }
+
+        if (mUI.checkForButtonClicked(ok_button))
+        {
+            for (int i = 0; i < ZGRegionOfInterest::MAX_POLYGONS; i++) {
+                region.setPolygon(i, polygons[i]);
+            }
+            region.setEnabled(true);
+            region.save(mUI);
+            return;
+        }
+
+        if (mUI.checkForButtonClicked(cancel_button))
+            return;
+    }
+}
@@ -9,18 +9,20 @@
 #include <Arduino.h>
 #include "ZGObjectTracker.h"
 #include "ZGLidar.h"
+#include "ZGGlyphCache.h"
 #include <TeensyUserInterface.h>
 #include "assets/font_Inter.h"
 #include "assets/font_ChakraPetch-SemiBold.h"
 #include <memory>
-#include "assets/SettingsButtonDefault.c"
-#include "assets/SettingsButtonPressed.c"
-#include "assets/BackButtonDefault.c"
-#include "assets/BackButtonPressed.c"
-#include "assets/SelectButtonDefault.c"
-#include "assets/SelectButtonPressed.c"
-#include "assets/OkButtonDefault.c"
-#include "assets/SettingsBackplate.c"
+#include <SD.h>
+#include "assets/SettingsButtonDefaultRLE.c"
+#include "assets/SettingsButtonPressedRLE.c"
+#include "assets/BackButtonDefaultRLE.c"
+#include "assets/BackButtonPressedRLE.c"
+#include "assets/SelectButtonDefaultRLE.c"
+#include "assets/SelectButtonPressedRLE.c"
+#include "assets/OkButtonDefaultRLE.c"
+#include "assets/SettingsBackplateRLE.c"
 
 #pragma once
 
@@ -36,6 +38,13 @@ namespace {
     const uint16_t dim_gray = 0x6B4C;
 }
 
+enum class MainView {
+    PLOT,
+    DEBUG,
+    HEATMAP,
+    LATENCY
+};
+
 
 class ZGDisplay {
 public:
@@ -53,24 +62,30 @@ public:
 
     void printDebugValue(int inValue, int inLine, TeensyUserInterface& inUI);
 
+    void printLatencyData(TeensyUserInterface& inUI, bool inRedrawAll = false);
+
     void plotObjects(TeensyUserInterface& inUI, bool inRedrawAll = false);
 
+    void plotHeatmap(TeensyUserInterface& inUI, bool inRedrawAll = false);
+
 private:
     // Pin Definitions
     const int LCD_CS_PIN = 10;
     const int LCD_DC_PIN = 9;
     const int TOUCH_CS_PIN = 8;
+    const int TOUCH_IRQ_PIN = 255; // Set to the pin wired to the touch controller's T_IRQ output, 255 polls over SPI
 
     TeensyUserInterface mUI;
 
-    bool showDebugData = false;
+    MainView mMainView = MainView::PLOT;
     bool mRedraw = true;
     elapsedMillis mRefreshTimer = 0;
+    elapsedMicros mLoopTimer = 0;
 
-    BUTTON_IMAGE mMenuButton {"",SettingsButtonDefault, SettingsButtonPressed, 287, 213, 40 , 40, ghost_white, Inter_12};
-    BUTTON_IMAGE mBackButton {"",BackButtonDefault, BackButtonPressed, 44, height - 14, 88 , 29, ghost_white, Inter_12};
-    BUTTON_IMAGE mOkButton {"OK", OkButtonDefault, SelectButtonPressed, 82, 203, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
-    BUTTON_IMAGE mCancelButton {"CANCEL", SelectButtonDefault, SelectButtonPressed, 237, 203, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
+    BUTTON_IMAGE mMenuButton {"",SettingsButtonDefaultRLE, SettingsButtonPressedRLE, 287, 213, 40 , 40, ghost_white, Inter_12};
+    BUTTON_IMAGE mBackButton {"",BackButtonDefaultRLE, BackButtonPressedRLE, 44, height - 14, 88 , 29, ghost_white, Inter_12};
+    BUTTON_IMAGE mOkButton {"OK", OkButtonDefaultRLE, SelectButtonPressedRLE, 82, 203, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
+    BUTTON_IMAGE mCancelButton {"CANCEL", SelectButtonDefaultRLE, SelectButtonPressedRLE, 237, 203, 144 , 50, ghost_white, ChakraPetchSemiBold_12};
 
     const uint16_t colorArray [6] {
             LCD_BLUE,
@@ -81,27 +96,77 @@ private:
             LCD_ORANGE
     };
 
-    const String debugCategories [5] {
+    const String debugCategories [13] {
             "Samples Per Second: ",
             "Buffer Size: ",
             "Total Latency: ",
             "Processing Latency: ",
-            "Objects Tracked: "
+            "Objects Tracked: ",
+            "Touch Reads Skipped %: ",
+            "MIDI Bytes Per Second: ",
+            "MIDI Dropped Per Second: ",
+            "MIDI Clock BPM: ",
+            "Background Removed %: ",
+            "Clustering Work %: ",
+            "Compute Level: ",
+            "Points Kept %: "
+    };
+
+    uint16_t mHeatmapColors [256] {};
+
+    ZGGlyphCache mDebugGlyphs;
+    ZGNumberField mDebugFields [13];
+
+    // Latency page: one row per measurement with p50, p95, p99 and max followed by a histogram
+    static constexpr int GRAPH_FIRST_BIN = 30; // 384us
+    static constexpr int GRAPH_BARS = 44;
+    static constexpr int GRAPH_BAR_WIDTH = 2;
+    static constexpr int GRAPH_WIDTH = GRAPH_BARS * GRAPH_BAR_WIDTH;
+    static constexpr int GRAPH_HEIGHT = 30;
+
+    const String latencyCategories [4] {
+            "Scan To MIDI",
+            "Processing",
+            "Loop Period",
+            "Display Frame"
     };
 
+    ZGLatencyStats mLoopStats;
+    ZGLatencyStats mFrameStats;
+    ZGGlyphCache mLatencyGlyphs;
+    ZGNumberField mLatencyFields [4][4];
+    uint16_t mGraphPixels [GRAPH_WIDTH * GRAPH_HEIGHT] {};
+
     ZGObjectTracker* mObjectTracker;
     ZGLidar* mLidar;
 
     std::vector<ZGPoint> mDisplayedObjects;
-    std::vector<std::vector<ZGPoint>> mDisplayedClusters;
+    std::vector<ZGPoint> mDisplayedPoints;
 
     float _getScaleFactor();
 
+    void _buildHeatmapColors();
+
+    /**
+     * @brief Writes anything with a writeCSV(Print&) function to serial or a file on the SD card
+     * @param inDestination 0 does nothing, 1 is serial and 2 is the SD card
+     */
+    template<typename T>
+    void _exportCSV(const T& inSource, int inDestination, const char* inFileName);
+
+    void _drawLatencyGraph(TeensyUserInterface& inUI, const ZGLatencyStats& inStats, int inX, int inY);
+
     void showMainMenu(TeensyUserInterface& ui);
     void showAbout(TeensyUserInterface& ui);
     void showScan();
     void showDisplay();
     void showMidi();
+    void showMapping();
+
+    /**
+     * @brief Full screen polygon editor drawn over the scan range, points are placed by touching the plot
+     */
+    void showRegion();
 
 
 
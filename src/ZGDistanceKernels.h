@@ -0,0 +1,128 @@
+//
+// ZGDistanceKernels.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <cstdint>
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#pragma once
+
+/**
+ * @brief Radius queries over structure of arrays point storage. Every kernel compares squared distances so no square
+ * root is taken, and writes the indices of the points within the radius to an output array that must hold inCount
+ * entries. Kept free of Arduino includes so tools/bench_distance_kernels.cpp can build it on the host.
+ */
+namespace ZGDistanceKernels {
+
+    // Packed coordinates are clamped to this many mm so dx² + dy² of any two points still fits an int32
+    constexpr int32_t MAX_PACKED_MM = 16383;
+
+    /**
+     * @brief Packs a point in cm as x and y millimeters in the low and high half words, the layout the DSP kernel reads
+     */
+    inline uint32_t packMillimeters(float inX, float inY) {
+        auto x = static_cast<int32_t>(inX * 10.f);
+        auto y = static_cast<int32_t>(inY * 10.f);
+        x = x < -MAX_PACKED_MM ? -MAX_PACKED_MM : (x > MAX_PACKED_MM ? MAX_PACKED_MM : x);
+        y = y < -MAX_PACKED_MM ? -MAX_PACKED_MM : (y > MAX_PACKED_MM ? MAX_PACKED_MM : y);
+        return static_cast<uint16_t>(x) | static_cast<uint32_t>(static_cast<uint16_t>(y)) << 16;
+    }
+
+    /**
+     * @brief Reference kernel, one point per iteration
+     * @return Number of indices written to outIndices
+     */
+    inline int findNeighboursScalar(const float* inX, const float* inY, int inCount, float inQueryX, float inQueryY,
+                                    float inRadiusSquared, int* outIndices) {
+        auto found = 0;
+        for (int i = 0; i < inCount; i++) {
+            auto dx = inX[i] - inQueryX;
+            auto dy = inY[i] - inQueryY;
+            if (dx * dx + dy * dy <= inRadiusSquared) {
+                outIndices[found++] = i;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Same query on packed millimeter coordinates. On the Cortex-M7, which has no floating point SIMD, QSUB16
+     * subtracts both coordinates at once and SMUAD returns dx² + dy² in a single instruction
+     * @param inRadiusSquared Squared radius in mm²
+     * @return Number of indices written to outIndices
+     */
+    inline int findNeighboursPacked(const uint32_t* inPoints, int inCount, uint32_t inQuery, int32_t inRadiusSquared,
+                                    int* outIndices) {
+        auto found = 0;
+        for (int i = 0; i < inCount; i++) {
+#if defined(__ARM_FEATURE_DSP)
+            uint32_t delta;
+            int32_t distance;
+            asm ("qsub16 %0, %1, %2" : "=r" (delta) : "r" (inPoints[i]), "r" (inQuery));
+            asm ("smuad %0, %1, %1" : "=r" (distance) : "r" (delta));
+#else
+            auto dx = static_cast<int32_t>(static_cast<int16_t>(inPoints[i])) - static_cast<int16_t>(inQuery);
+            auto dy = static_cast<int32_t>(static_cast<int16_t>(inPoints[i] >> 16)) - static_cast<int16_t>(inQuery >> 16);
+            auto distance = dx * dx + dy * dy;
+#endif
+            if (distance <= inRadiusSquared) {
+                outIndices[found++] = i;
+            }
+        }
+        return found;
+    }
+
+    /**
+     * @brief Widest float kernel the target supports, 8 points per iteration with AVX and 4 with SSE2. Falls back to
+     * the scalar kernel on targets without either
+     * @return Number of indices written to outIndices
+     */
+    inline int findNeighboursSIMD(const float* inX, const float* inY, int inCount, float inQueryX, float inQueryY,
+                                  float inRadiusSquared, int* outIndices) {
+        auto found = 0;
+        auto i = 0;
+#if defined(__AVX__)
+        auto query_x = _mm256_set1_ps(inQueryX);
+        auto query_y = _mm256_set1_ps(inQueryY);
+        auto radius = _mm256_set1_ps(inRadiusSquared);
+        for (; i + 8 <= inCount; i += 8) {
+            auto dx = _mm256_sub_ps(_mm256_loadu_ps(inX + i), query_x);
+            auto dy = _mm256_sub_ps(_mm256_loadu_ps(inY + i), query_y);
+            auto distance = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+            auto mask = _mm256_movemask_ps(_mm256_cmp_ps(distance, radius, _CMP_LE_OQ));
+            while (mask != 0) {
+                outIndices[found++] = i + __builtin_ctz(mask);
+                mask &= mask - 1;
+            }
+        }
+#elif defined(__SSE2__)
+        auto query_x = _mm_set1_ps(inQueryX);
+        auto query_y = _mm_set1_ps(inQueryY);
+        auto radius = _mm_set1_ps(inRadiusSquared);
+        for (; i + 4 <= inCount; i += 4) {
+            auto dx = _mm_sub_ps(_mm_loadu_ps(inX + i), query_x);
+            auto dy = _mm_sub_ps(_mm_loadu_ps(inY + i), query_y);
+            auto distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            auto mask = _mm_movemask_ps(_mm_cmple_ps(distance, radius));
+            while (mask != 0) {
+                outIndices[found++] = i + __builtin_ctz(mask);
+                mask &= mask - 1;
+            }
+        }
+#endif
+        // Remaining points, or all of them without SIMD
+        auto tail = findNeighboursScalar(inX + i, inY + i, inCount - i, inQueryX, inQueryY, inRadiusSquared,
+                                         outIndices + found);
+        for (int j = found; j < found + tail; j++) {
+            outIndices[j] += i;
+        }
+        return found + tail;
+    }
+
+}
@@ -0,0 +1,40 @@
+//
+// ZGFastTrig.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGFastTrig.h"
+
+namespace {
+
+    /**
+     * @brief Taylor series in double precision, since std::sin can't be evaluated at compile time
+     */
+    constexpr double tableSine(int inIndex) {
+        // Reduced to -π..π, where 13 terms are exact to well below float precision
+        auto turn = inIndex > ZGFastTrig::SINE_TABLE_SIZE / 2 ? inIndex - ZGFastTrig::SINE_TABLE_SIZE : inIndex;
+        auto x = 2.0 * 3.14159265358979323846 * turn / ZGFastTrig::SINE_TABLE_SIZE;
+        auto term = x;
+        auto sum = x;
+        for (int n = 1; n < 13; n++) {
+            term *= -x * x / ((2 * n) * (2 * n + 1));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr ZGFastTrig::SineTable makeSineTable() {
+        ZGFastTrig::SineTable table {};
+        for (int i = 0; i <= ZGFastTrig::SINE_TABLE_SIZE; i++) {
+            table.values[i] = static_cast<float>(tableSine(i));
+        }
+        return table;
+    }
+
+}
+
+// Built by the compiler, so the table sits in flash and is valid before any constructor runs
+const ZGFastTrig::SineTable ZGFastTrig::SINE_TABLE = makeSineTable();
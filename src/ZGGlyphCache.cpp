@@ -0,0 +1,211 @@
+//
+// ZGGlyphCache.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGGlyphCache.h"
+
+constexpr int ZGNumberField::MAX_CHARACTERS;
+
+namespace {
+    // Bit readers matching the packed font format decoded by ILI9341_t3::drawFontChar()
+
+    uint32_t fetchBit(const uint8_t* inData, uint32_t inIndex) {
+        return (inData[inIndex >> 3] >> (7 - (inIndex & 7))) & 1;
+    }
+
+    uint32_t fetchBitsUnsigned(const uint8_t* inData, uint32_t inIndex, uint32_t inRequired) {
+        uint32_t value = 0;
+        while (inRequired) {
+            uint32_t byte = inData[inIndex >> 3];
+            uint32_t available = 8 - (inIndex & 7);
+            if (available <= inRequired) {
+                value = (value << available) | (byte & ((1 << available) - 1));
+                inIndex += available;
+                inRequired -= available;
+            } else {
+                byte >>= available - inRequired;
+                value = (value << inRequired) | (byte & ((1 << inRequired) - 1));
+                break;
+            }
+        }
+        return value;
+    }
+
+    int32_t fetchBitsSigned(const uint8_t* inData, uint32_t inIndex, uint32_t inRequired) {
+        auto value = fetchBitsUnsigned(inData, inIndex, inRequired);
+        if (value & (1 << (inRequired - 1))) {
+            return static_cast<int32_t>(value) - (1 << inRequired);
+        }
+        return static_cast<int32_t>(value);
+    }
+
+    const uint8_t* findGlyph(const ui_font& inFont, char inCharacter) {
+        uint32_t c = static_cast<uint8_t>(inCharacter);
+        uint32_t bit_offset;
+        if (c >= inFont.index1_first && c <= inFont.index1_last) {
+            bit_offset = (c - inFont.index1_first) * inFont.bits_index;
+        } else if (c >= inFont.index2_first && c <= inFont.index2_last) {
+            bit_offset = (c - inFont.index2_first + inFont.index1_last - inFont.index1_first + 1) * inFont.bits_index;
+        } else {
+            return nullptr;
+        }
+        return inFont.data + fetchBitsUnsigned(inFont.index, bit_offset, inFont.bits_index);
+    }
+
+    int glyphAdvance(const ui_font& inFont, char inCharacter) {
+        auto data = findGlyph(inFont, inCharacter);
+        if (data == nullptr || fetchBitsUnsigned(data, 0, 3) != 0) {
+            return 0;
+        }
+        uint32_t bit_offset = 3 + inFont.bits_width + inFont.bits_height + inFont.bits_xoffset + inFont.bits_yoffset;
+        return static_cast<int>(fetchBitsUnsigned(data, bit_offset, inFont.bits_delta));
+    }
+}
+
+ZGGlyphCache::ZGGlyphCache() = default;
+
+ZGGlyphCache::~ZGGlyphCache() = default;
+
+void ZGGlyphCache::rasterize(const ui_font& inFont, uint16_t inTextColor, uint16_t inBackgroundColor, int inCellHeight) {
+    // Every cell is as wide as the widest cached character so digits line up and can be replaced in place
+    mCellWidth = 0;
+    for (int i = 0; i < CACHED_CHARACTER_COUNT; i++) {
+        mCellWidth = std::max(mCellWidth, glyphAdvance(inFont, CACHED_CHARACTERS[i]));
+    }
+    mCellHeight = inCellHeight > 0 ? inCellHeight : inFont.line_space;
+
+    for (auto& index : mCharacterIndex) {
+        index = 0; // blank
+    }
+    for (int i = 0; i < CACHED_CHARACTER_COUNT; i++) {
+        mCharacterIndex[static_cast<uint8_t>(CACHED_CHARACTERS[i])] = static_cast<int8_t>(i);
+    }
+
+    auto cell_size = mCellWidth * mCellHeight;
+    mPixels.assign(cell_size * CACHED_CHARACTER_COUNT, inBackgroundColor);
+    for (int i = 0; i < CACHED_CHARACTER_COUNT; i++) {
+        _rasterizeGlyph(inFont, CACHED_CHARACTERS[i], &mPixels[i * cell_size], inTextColor);
+    }
+}
+
+void ZGGlyphCache::_rasterizeGlyph(const ui_font& inFont, char inCharacter, uint16_t* outCell, uint16_t inTextColor) const {
+    auto data = findGlyph(inFont, inCharacter);
+    if (data == nullptr || fetchBitsUnsigned(data, 0, 3) != 0) {
+        return;
+    }
+
+    uint32_t bit_offset = 3;
+    auto glyph_width = static_cast<int>(fetchBitsUnsigned(data, bit_offset, inFont.bits_width));
+    bit_offset += inFont.bits_width;
+    auto glyph_height = static_cast<int>(fetchBitsUnsigned(data, bit_offset, inFont.bits_height));
+    bit_offset += inFont.bits_height;
+    auto x_offset = fetchBitsSigned(data, bit_offset, inFont.bits_xoffset);
+    bit_offset += inFont.bits_xoffset;
+    auto y_offset = fetchBitsSigned(data, bit_offset, inFont.bits_yoffset);
+    bit_offset += inFont.bits_yoffset;
+    auto advance = static_cast<int>(fetchBitsUnsigned(data, bit_offset, inFont.bits_delta));
+    bit_offset += inFont.bits_delta;
+
+    // Narrow characters are centered in the cell, same vertical placement as lcdPrint()
+    auto origin_x = (mCellWidth - advance) / 2 + x_offset;
+    auto origin_y = inFont.cap_height - glyph_height - y_offset;
+
+    auto paintRow = [&](int inY, uint32_t inBitOffset) {
+        for (int x = 0; x < glyph_width; x++) {
+            auto cell_x = origin_x + x;
+            if (fetchBit(data, inBitOffset + x) && inY >= 0 && inY < mCellHeight && cell_x >= 0 && cell_x < mCellWidth) {
+                outCell[inY * mCellWidth + cell_x] = inTextColor;
+            }
+        }
+    };
+
+    // Each line is either stored once, or flagged as repeated for 2-9 lines
+    auto y = origin_y;
+    auto lines_left = glyph_height;
+    while (lines_left > 0) {
+        auto repeat = 1;
+        if (fetchBit(data, bit_offset++)) {
+            repeat = static_cast<int>(fetchBitsUnsigned(data, bit_offset, 3)) + 2;
+            bit_offset += 3;
+        }
+        for (int r = 0; r < repeat; r++) {
+            paintRow(y + r, bit_offset);
+        }
+        bit_offset += glyph_width;
+        y += repeat;
+        lines_left -= repeat;
+    }
+}
+
+void ZGGlyphCache::drawNumber(TeensyUserInterface& inUI, ZGNumberField& inField, int inValue, int inDecimals) {
+    char text[ZGNumberField::MAX_CHARACTERS + 1];
+    auto characters = std::min(inField.characters, ZGNumberField::MAX_CHARACTERS);
+    inDecimals = std::max(0, std::min(inDecimals, characters - 2));
+
+    // Clamp instead of overflowing the field
+    auto limit = 1;
+    for (int i = 0; i < characters - (inValue < 0 ? 1 : 0) - (inDecimals > 0 ? 1 : 0); i++) {
+        limit *= 10;
+    }
+    inValue = std::max(std::min(inValue, limit - 1), -(limit - 1));
+
+    // Digits are written back to front into a fixed buffer, with at least one digit before the decimal point
+    auto magnitude = static_cast<unsigned int>(inValue < 0 ? -inValue : inValue);
+    char digits[ZGNumberField::MAX_CHARACTERS];
+    auto digit_count = 0;
+    do {
+        digits[digit_count++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while ((magnitude != 0 || digit_count <= inDecimals) && digit_count < characters);
+
+    auto length = 0;
+    if (inValue < 0) {
+        text[length++] = '-';
+    }
+    while (digit_count > 0) {
+        if (digit_count == inDecimals) {
+            text[length++] = '.';
+        }
+        text[length++] = digits[--digit_count];
+    }
+    text[length] = 0;
+
+    drawText(inUI, inField, text);
+}
+
+void ZGGlyphCache::drawText(TeensyUserInterface& inUI, ZGNumberField& inField, const char* inText) {
+    auto characters = std::min(inField.characters, ZGNumberField::MAX_CHARACTERS);
+    auto ended = false;
+    for (int i = 0; i < characters; i++) {
+        if (!ended && inText[i] == 0) {
+            ended = true;
+        }
+        auto c = ended ? ' ' : inText[i];
+        if (inField.drawn[i] != c) {
+            _drawCell(inUI, inField, i, c);
+        }
+    }
+}
+
+void ZGGlyphCache::_drawCell(TeensyUserInterface& inUI, ZGNumberField& inField, int inIndex, char inCharacter) {
+    if (mPixels.empty()) {
+        return;
+    }
+    auto c = static_cast<uint8_t>(inCharacter);
+    auto glyph = c < 128 ? mCharacterIndex[c] : 0;
+    auto cell = &mPixels[glyph * mCellWidth * mCellHeight];
+    inUI.lcdDrawImage(inField.x + inIndex * mCellWidth, inField.y, mCellWidth, mCellHeight, cell);
+    inField.drawn[inIndex] = inCharacter;
+}
+
+const int& ZGGlyphCache::getCellWidth() const {
+    return mCellWidth;
+}
+
+const int& ZGGlyphCache::getCellHeight() const {
+    return mCellHeight;
+}
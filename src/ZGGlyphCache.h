@@ -0,0 +1,102 @@
+//
+// ZGGlyphCache.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <TeensyUserInterface.h>
+#include <vector>
+#include <algorithm>
+
+#pragma once
+
+/**
+ * @brief Screen position and last drawn characters of a number printed through a ZGGlyphCache
+ */
+struct ZGNumberField {
+    static constexpr int MAX_CHARACTERS = 8;
+
+    int x = 0;
+    int y = 0;
+    int characters = 6;
+    char drawn[MAX_CHARACTERS] {};
+
+    /**
+     * @brief Forces every character of the field to be drawn on the next update, call after the screen was cleared
+     */
+    void invalidate() {
+        for (auto& c : drawn) {
+            c = 0;
+        }
+    }
+};
+
+/**
+ * @brief Holds pre-rasterized RGB565 copies of the digits and a few common characters of a font. Numbers drawn through
+ * the cache use fixed width character cells, so only cells whose character changed are sent to the LCD, each with a
+ * single image write and without any heap allocation or font decoding.
+ */
+class ZGGlyphCache {
+public:
+    /* */
+    ZGGlyphCache();
+
+    /* */
+    ~ZGGlyphCache();
+
+    /**
+     * @brief Decodes the cached character set of a font into pixel blocks. Call once during setup, or again if the
+     * font or colors change
+     * @param inFont An ILI9341_t3 font, eg. Inter_12
+     * @param inTextColor RGB565 color of the text
+     * @param inBackgroundColor RGB565 color used for the rest of each character cell
+     * @param inCellHeight Height of the cells in pixels, defaults to the font's line spacing. Pass the line pitch when
+     * fields are stacked closer than that so cells don't overwrite the line below
+     */
+    void rasterize(const ui_font& inFont, uint16_t inTextColor, uint16_t inBackgroundColor, int inCellHeight = 0);
+
+    /**
+     * @brief Prints a number left aligned into a field, only redrawing the cells whose character changed. Values that
+     * do not fit in the field are clamped to the largest value that does
+     * @param inUI User interface used to access the LCD
+     * @param inField Field to update, remembers what is currently on screen
+     * @param inValue Value to print
+     * @param inDecimals Number of digits of inValue to print after a decimal point, eg. 1234 with 1 prints 123.4
+     */
+    void drawNumber(TeensyUserInterface& inUI, ZGNumberField& inField, int inValue, int inDecimals = 0);
+
+    /**
+     * @brief Prints a short string made of cached characters into a field. Characters outside the cached set are
+     * drawn as blanks
+     */
+    void drawText(TeensyUserInterface& inUI, ZGNumberField& inField, const char* inText);
+
+    /**
+     * @return Width in pixels of a single character cell
+     */
+    const int& getCellWidth() const;
+
+    /**
+     * @return Height in pixels of a single character cell
+     */
+    const int& getCellHeight() const;
+
+private:
+
+    static constexpr const char* CACHED_CHARACTERS = " 0123456789-.:";
+    static constexpr int CACHED_CHARACTER_COUNT = 14;
+
+    void _rasterizeGlyph(const ui_font& inFont, char inCharacter, uint16_t* outCell, uint16_t inTextColor) const;
+
+    void _drawCell(TeensyUserInterface& inUI, ZGNumberField& inField, int inIndex, char inCharacter);
+
+    int mCellWidth = 0;
+    int mCellHeight = 0;
+    int8_t mCharacterIndex[128] {};
+
+    std::vector<uint16_t> mPixels {};
+
+};
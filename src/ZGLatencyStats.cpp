@@ -0,0 +1,74 @@
+//
+// ZGLatencyStats.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGLatencyStats.h"
+
+ZGLatencyStats::ZGLatencyStats() = default;
+
+ZGLatencyStats::~ZGLatencyStats() = default;
+
+void ZGLatencyStats::addSample(uint32_t inMicroseconds) {
+    if (mSampleCount == WINDOW_SIZE) {
+        mHistogram[_getBin(mWindow[mNextSample])]--;
+    } else {
+        mSampleCount++;
+    }
+    mWindow[mNextSample] = inMicroseconds;
+    mHistogram[_getBin(inMicroseconds)]++;
+    mNextSample = (mNextSample + 1) % WINDOW_SIZE;
+}
+
+uint32_t ZGLatencyStats::getPercentile(int inPercent) const {
+    if (mSampleCount == 0) {
+        return 0;
+    }
+    auto target = (mSampleCount * inPercent + 99) / 100;
+    auto total = 0;
+    for (int bin = 0; bin < BIN_COUNT; bin++) {
+        total += mHistogram[bin];
+        if (total >= target) {
+            // Middle of the bin
+            return (getBinStart(bin) + getBinStart(bin + 1)) / 2;
+        }
+    }
+    return getMax();
+}
+
+uint32_t ZGLatencyStats::getMax() const {
+    uint32_t max_sample = 0;
+    for (int i = 0; i < mSampleCount; i++) {
+        max_sample = std::max(max_sample, mWindow[i]);
+    }
+    return max_sample;
+}
+
+const uint16_t *ZGLatencyStats::getHistogram() const {
+    return mHistogram;
+}
+
+const int &ZGLatencyStats::getSampleCount() const {
+    return mSampleCount;
+}
+
+int ZGLatencyStats::_getBin(uint32_t inMicroseconds) {
+    if (inMicroseconds < 4) {
+        return static_cast<int>(inMicroseconds);
+    }
+    // Four bins per octave: the octave picks the group, the next two bits below the leading one pick the bin
+    auto octave = 31 - __builtin_clz(inMicroseconds);
+    auto bin = (octave - 1) * 4 + static_cast<int>((inMicroseconds >> (octave - 2)) & 3);
+    return std::min(bin, BIN_COUNT - 1);
+}
+
+uint32_t ZGLatencyStats::getBinStart(int inBin) {
+    if (inBin < 4) {
+        return static_cast<uint32_t>(inBin);
+    }
+    auto octave = inBin / 4 + 1;
+    return static_cast<uint32_t>(4 + inBin % 4) << (octave - 2);
+}
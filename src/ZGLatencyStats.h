@@ -0,0 +1,71 @@
+//
+// ZGLatencyStats.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <algorithm>
+
+#pragma once
+
+/**
+ * @brief Streaming histogram of timing samples over a sliding window. Bins are spaced logarithmically with four bins per
+ * power of two, so percentiles are accurate to within about 12% from 1us up to several seconds. Adding a sample is
+ * constant time, percentiles are read by walking the bins.
+ */
+class ZGLatencyStats {
+public:
+    static constexpr int WINDOW_SIZE = 256;
+    static constexpr int BIN_COUNT = 96;
+
+    /* */
+    ZGLatencyStats();
+
+    /* */
+    ~ZGLatencyStats();
+
+    /**
+     * @brief Adds a sample, replacing the oldest one once the window is full
+     * @param inMicroseconds Measured duration
+     */
+    void addSample(uint32_t inMicroseconds);
+
+    /**
+     * @param inPercent Percentile to read, eg. 50, 95 or 99
+     * @return Approximate value in microseconds that inPercent of the samples in the window are at or below
+     */
+    uint32_t getPercentile(int inPercent) const;
+
+    /**
+     * @return Exact largest sample in the window in microseconds
+     */
+    uint32_t getMax() const;
+
+    /**
+     * @return Number of samples in each bin for the current window
+     */
+    const uint16_t* getHistogram() const;
+
+    /**
+     * @return Number of samples currently in the window
+     */
+    const int& getSampleCount() const;
+
+    /**
+     * @return Smallest value in microseconds that falls into the given bin
+     */
+    static uint32_t getBinStart(int inBin);
+
+private:
+
+    static int _getBin(uint32_t inMicroseconds);
+
+    uint32_t mWindow[WINDOW_SIZE] {};
+    uint16_t mHistogram[BIN_COUNT] {};
+    int mNextSample = 0;
+    int mSampleCount = 0;
+
+};
@@ -41,20 +41,23 @@ void ZGLidar::_readLidarBuffer()
     size_t nodeCount = 512; // variable will be set to number of received measurement by reference
     u_result ans = mLidar.grabScanExpressData(nodes, nodeCount);
     if (IS_OK(ans)){
+        // Samples are stamped when they reach us, which is as close to the measurement as the driver lets us get
+        auto sample_time = micros();
         // If the data is valid, write all samples with a quality greater than 0 to processing buffer
         for (size_t i = 0; i < nodeCount; ++i){
             // Trigger processing when new scan flag is received
-            if (nodes[i].flag == 1 || mPointBuffer.size() >= 512) {
+            if (nodes[i].flag == 1 || mRangeImage.getSampleCount() >= MAX_SAMPLES_PER_REVOLUTION) {
                 mReadyToProcess = true;
             }
 
             if (nodes[i].quality == 0) {
+                mRangeImage.addMiss();
                 continue;
             } else {
-                ZGPolarData p;
-                p.distance = nodes[i].dist_mm_q2 / 10.f / (1<<2); //cm
-                p.angle = nodes[i].angle_z_q14 * 90.f / (1<<14); //degrees
-                mPointBuffer.push_back(p);
+                if (mRangeImage.getSampleCount() == 0) {
+                    mScanTimer = 0; // first sample of this revolution
+                }
+                mRangeImage.addRawSample(nodes[i].angle_z_q14, nodes[i].dist_mm_q2, sample_time);
                 mSampleCount++;
             }
         }
@@ -65,8 +68,11 @@ void ZGLidar::_processInternalBuffer() {
     // Process sample buffer when a single scan is complete and generate latency report strings
     if (mReadyToProcess) {
         mProcessWait = 0;
-        mBufferSize = static_cast<int>(mPointBuffer.size());
-        mObjectTracker->processBuffer(mPointBuffer);
+        elapsedMicros process_timer = 0;
+        mBufferSize = mRangeImage.getSampleCount();
+        mObjectTracker->processBuffer(mRangeImage);
+        mProcessingStats.addSample(process_timer);
+        mScanToMidiStats.addSample(mScanTimer);
         mProcessingLatency = static_cast<int>(mProcessWait);
         mTotalLatency =static_cast<int>(mLatency);
         mLatency = 0;
@@ -99,6 +105,14 @@ const int &ZGLidar::getBufferSize() const {
     return mBufferSize;
 }
 
+const ZGLatencyStats &ZGLidar::getScanToMidiStats() const {
+    return mScanToMidiStats;
+}
+
+const ZGLatencyStats &ZGLidar::getProcessingStats() const {
+    return mProcessingStats;
+}
+
 void ZGLidar::pause() {
     mLidar.stop();
 }
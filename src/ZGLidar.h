@@ -10,6 +10,8 @@
 #include <rplidar_driver_impl.h>
 #include <vector>
 #include "ZGObjectTracker.h"
+#include "ZGLatencyStats.h"
+#include "ZGRangeImage.h"
 
 #pragma once
 
@@ -38,6 +40,16 @@ public:
 
     const int& getBufferSize() const;
 
+    /**
+     * @return Distribution of the time from the first sample of a revolution until its MIDI has been sent
+     */
+    const ZGLatencyStats& getScanToMidiStats() const;
+
+    /**
+     * @return Distribution of the time spent in ZGObjectTracker::processBuffer()
+     */
+    const ZGLatencyStats& getProcessingStats() const;
+
 private:
 
     void _readLidarBuffer();
@@ -52,6 +64,7 @@ private:
     elapsedMillis mTimer = 0;
     elapsedMillis mProcessWait = 0;
     elapsedMillis mLatency = 0;
+    elapsedMicros mScanTimer = 0;
 
     int mSampleCount = 0;
     int mSamplesPerSecond = 0;
@@ -60,7 +73,13 @@ private:
     int mProcessingLatency = 0;
     bool mReadyToProcess = false;
 
-    std::vector<ZGPolarData> mPointBuffer;
+    ZGLatencyStats mScanToMidiStats;
+    ZGLatencyStats mProcessingStats;
+
+    // Processing is forced after this many samples in case the new scan flag is missed
+    static constexpr int MAX_SAMPLES_PER_REVOLUTION = 2 * ZGRangeImage::ANGLE_BINS;
+
+    ZGRangeImage mRangeImage {};
     ZGObjectTracker* mObjectTracker;
 
 };
@@ -0,0 +1,103 @@
+//
+// ZGMidiClock.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGMidiClock.h"
+
+ZGMidiClock::ZGMidiClock() = default;
+
+ZGMidiClock::~ZGMidiClock() = default;
+
+void ZGMidiClock::processMessage(uint8_t inType, uint8_t inData1, uint8_t inData2, uint32_t inTime) {
+    switch (inType) {
+        case usbMIDI.Clock:
+            _tick(inTime);
+            break;
+        case usbMIDI.Start:
+            mRunning = true;
+            mTickCount = -1;
+            break;
+        case usbMIDI.Continue:
+            mRunning = true;
+            break;
+        case usbMIDI.Stop:
+            mRunning = false;
+            break;
+        case usbMIDI.SongPosition:
+            // Song position counts sixteenth notes, the next tick lands on it
+            mTickCount = ((inData2 << 7) | inData1) * (TICKS_PER_BEAT / 4) - 1;
+            break;
+        default:
+            break;
+    }
+}
+
+void ZGMidiClock::_tick(uint32_t inTime) {
+    if (mBeatTicks < 0 || inTime - mLastTickTime > CLOCK_TIMEOUT) {
+        // First tick or clock came back after a pause, measure the tempo from scratch
+        mTickPeriod = 0;
+        mTickTime = inTime;
+        mBeatStartTime = inTime;
+        mBeatTicks = 0;
+    } else {
+        mBeatTicks++;
+        if (mTickPeriod > 0) {
+            auto predicted = mTickTime + static_cast<uint32_t>(mTickPeriod);
+            auto error = static_cast<float>(static_cast<int32_t>(inTime - predicted));
+            // Large jumps are tempo changes rather than loop jitter, follow them immediately
+            mTickTime = std::abs(error) > mTickPeriod ? inTime : predicted + static_cast<int32_t>(error * PHASE_GAIN);
+        } else {
+            mTickTime = inTime;
+        }
+
+        if (mBeatTicks == TICKS_PER_BEAT) {
+            auto beat_period = static_cast<float>(inTime - mBeatStartTime) / TICKS_PER_BEAT;
+            mTickPeriod = mTickPeriod == 0 ? beat_period : mTickPeriod + (beat_period - mTickPeriod) * PERIOD_GAIN;
+            mBeatStartTime = inTime;
+            mBeatTicks = 0;
+        }
+    }
+    mLastTickTime = inTime;
+
+    if (mRunning) {
+        mTickCount++;
+    }
+}
+
+bool ZGMidiClock::isRunning(uint32_t inTime) const {
+    return mRunning && mTickCount >= 0 && mTickPeriod > 0 && inTime - mLastTickTime <= CLOCK_TIMEOUT;
+}
+
+uint32_t ZGMidiClock::getGridTime(uint32_t inTime, int inTicksPerStep, uint32_t inMaxDelay) const {
+    if (inTicksPerStep <= 0 || !isRunning(inTime)) {
+        return inTime;
+    }
+
+    auto step = static_cast<float>(inTicksPerStep);
+    auto position = static_cast<float>(mTickCount) + static_cast<float>(static_cast<int32_t>(inTime - mTickTime)) / mTickPeriod;
+    auto since_step = std::fmod(position, step);
+    if (since_step < 0) {
+        since_step += step;
+    }
+
+    // Late notes are closer to the line behind them and play right away instead of waiting a full step
+    if (since_step <= step * 0.5f) {
+        return inTime;
+    }
+    auto delay = (step - since_step) * mTickPeriod;
+    if (delay > static_cast<float>(inMaxDelay)) {
+        return inTime;
+    }
+    return inTime + static_cast<uint32_t>(delay);
+}
+
+int ZGMidiClock::getBpm(uint32_t inTime) const {
+    if (mTickPeriod <= 0 || inTime - mLastTickTime > CLOCK_TIMEOUT) {
+        return 0;
+    }
+    return static_cast<int>(60000000.f / (mTickPeriod * TICKS_PER_BEAT) + 0.5f);
+}
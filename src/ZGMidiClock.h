@@ -0,0 +1,72 @@
+//
+// ZGMidiClock.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+
+#pragma once
+
+/**
+ * @brief Follows incoming MIDI clock and transport messages. The tick period is estimated once per beat so the jitter of
+ * reading USB MIDI from the main loop is spread over 24 ticks, and the phase is pulled towards every received tick with
+ * a small gain. Grid positions are predicted from the estimate, so notes can be held until the next grid line.
+ */
+class ZGMidiClock {
+public:
+    static constexpr int TICKS_PER_BEAT = 24;
+
+    /* */
+    ZGMidiClock();
+
+    /* */
+    ~ZGMidiClock();
+
+    /**
+     * @brief Handles clock, start, continue, stop and song position messages, everything else is ignored
+     * @param inType Message type as returned by usbMIDI.getType()
+     * @param inTime micros() when the message was read
+     */
+    void processMessage(uint8_t inType, uint8_t inData1, uint8_t inData2, uint32_t inTime);
+
+    /**
+     * @return True while the transport is running and clock ticks arrive often enough to predict the grid
+     */
+    bool isRunning(uint32_t inTime) const;
+
+    /**
+     * @brief Finds when an event should be released to land on the grid. Events closer to the grid line behind them
+     * are released right away, as are events that would have to wait longer than inMaxDelay
+     * @param inTime micros() when the event was created
+     * @param inTicksPerStep Grid spacing in clock ticks, eg. 6 for sixteenth notes
+     * @param inMaxDelay Longest wait in microseconds
+     * @return micros() at which to release the event
+     */
+    uint32_t getGridTime(uint32_t inTime, int inTicksPerStep, uint32_t inMaxDelay) const;
+
+    /**
+     * @return Estimated tempo rounded to whole beats per minute, 0 while no clock is received
+     */
+    int getBpm(uint32_t inTime) const;
+
+private:
+
+    static constexpr uint32_t CLOCK_TIMEOUT = 250000; // No tick for this long, in microseconds, unlocks the tempo
+    static constexpr float PHASE_GAIN = 0.125f;
+    static constexpr float PERIOD_GAIN = 0.25f;
+
+    void _tick(uint32_t inTime);
+
+    bool mRunning = false;
+
+    int32_t mTickCount = -1;        // Ticks since start, the first tick after start is position 0
+    uint32_t mLastTickTime = 0;     // Raw arrival time of the last tick
+    uint32_t mTickTime = 0;         // Smoothed time of the last tick
+    float mTickPeriod = 0;          // Microseconds per tick, 0 until a full beat was measured
+    uint32_t mBeatStartTime = 0;
+    int mBeatTicks = -1;            // Ticks since mBeatStartTime, -1 until the first tick
+
+};
@@ -0,0 +1,215 @@
+//
+// ZGMidiMapping.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGMidiMapping.h"
+
+const char* const ZGMidiMapping::featureNames[FEATURE_COUNT] {
+        "X",
+        "Y",
+        "Angle",
+        "Distance",
+        "Speed",
+        "Angular Speed",
+        "Radial Speed",
+        "Cluster Size",
+        "Track Age"
+};
+
+ZGMidiMapping::ZGMidiMapping() {
+    for (int i = 0; i <= CURVE_TABLE_SIZE; i++) {
+        auto t = static_cast<float>(i) / CURVE_TABLE_SIZE;
+        mCurveTable[static_cast<int>(MidiCurve::LINEAR)][i] = static_cast<int32_t>(t * 65536.f);
+        mCurveTable[static_cast<int>(MidiCurve::EXPONENTIAL)][i] = static_cast<int32_t>(t * t * 65536.f);
+        mCurveTable[static_cast<int>(MidiCurve::LOGARITHMIC)][i] = static_cast<int32_t>(std::sqrt(t) * 65536.f);
+        mCurveTable[static_cast<int>(MidiCurve::INVERTED)][i] = static_cast<int32_t>((1.f - t) * 65536.f);
+    }
+    setDefaultRoutes();
+}
+
+ZGMidiMapping::~ZGMidiMapping() = default;
+
+void ZGMidiMapping::setDefaultRoutes() {
+    for (auto& route : mRoutes) {
+        route = ZGMidiRoute{};
+    }
+    mRoutes[0] = makeRoute(MidiFeature::ANGLE, MidiDestination::NOTE);
+    mRoutes[1] = makeRoute(MidiFeature::DISTANCE, MidiDestination::CONTROL_CHANGE_14, 1, MidiCurve::INVERTED);
+    mRoutes[2] = makeRoute(MidiFeature::SPEED, MidiDestination::CONTROL_CHANGE, 74);
+    mRoutes[2].outputMin = 63;
+    mRoutes[3] = makeRoute(MidiFeature::SPEED, MidiDestination::PRESSURE);
+    _compile();
+}
+
+ZGMidiRoute ZGMidiMapping::makeRoute(MidiFeature inFeature, MidiDestination inDestination, int inController,
+                                     MidiCurve inCurve, int inSmoothing) {
+    // Natural range of each feature, indexed by MidiFeature
+    const int16_t input_ranges [FEATURE_COUNT][2] {
+            {-100, 100},
+            {-100, 100},
+            {0, 360},
+            {0, 100},
+            {0, 700},
+            {-180, 180},
+            {-300, 300},
+            {0, 200},
+            {0, 30}
+    };
+    // Full range of each destination, indexed by MidiDestination
+    const int16_t output_ranges [6][2] {
+            {0, 0},
+            {0, 16383},
+            {0, 127},
+            {0, 16383},
+            {0, 16383},
+            {0, 127}
+    };
+
+    ZGMidiRoute route;
+    route.feature = inFeature;
+    route.destination = inDestination;
+    route.controller = static_cast<uint8_t>(inController);
+    route.curve = inCurve;
+    route.smoothing = static_cast<uint8_t>(inSmoothing);
+    route.inputMin = input_ranges[static_cast<int>(inFeature)][0];
+    route.inputMax = input_ranges[static_cast<int>(inFeature)][1];
+    route.outputMin = output_ranges[static_cast<int>(inDestination)][0];
+    route.outputMax = output_ranges[static_cast<int>(inDestination)][1];
+    return route;
+}
+
+const ZGMidiRoute &ZGMidiMapping::getRoute(int inIndex) const {
+    return mRoutes[inIndex];
+}
+
+void ZGMidiMapping::setRoute(int inIndex, const ZGMidiRoute &inRoute) {
+    mRoutes[inIndex] = inRoute;
+    _compile();
+}
+
+void ZGMidiMapping::load(TeensyUserInterface &inUI) {
+    if (inUI.readConfigurationInt(EEPROM_ADDRESS, 0) != EEPROM_FORMAT) {
+        setDefaultRoutes();
+        return;
+    }
+
+    // Every int takes 5 bytes of EEPROM, routes are stored as 3 packed ints
+    for (int i = 0; i < MAX_ROUTES; i++) {
+        auto address = EEPROM_ADDRESS + 5 + i * 15;
+        auto settings = static_cast<uint32_t>(inUI.readConfigurationInt(address, 0));
+        auto input = static_cast<uint32_t>(inUI.readConfigurationInt(address + 5, 0));
+        auto output = static_cast<uint32_t>(inUI.readConfigurationInt(address + 10, 0));
+
+        ZGMidiRoute route;
+        auto feature = settings & 0xF;
+        auto destination = (settings >> 4) & 0xF;
+        auto curve = (settings >> 8) & 0xF;
+        if (feature < FEATURE_COUNT && destination <= static_cast<uint32_t>(MidiDestination::PRESSURE) &&
+            curve < CURVE_COUNT) {
+            route.feature = static_cast<MidiFeature>(feature);
+            route.destination = static_cast<MidiDestination>(destination);
+            route.curve = static_cast<MidiCurve>(curve);
+            route.smoothing = static_cast<uint8_t>(std::min<uint32_t>((settings >> 12) & 0xF, 8));
+            route.controller = static_cast<uint8_t>((settings >> 16) & 127);
+            route.inputMin = static_cast<int16_t>(input & 0xFFFF);
+            route.inputMax = static_cast<int16_t>(input >> 16);
+            route.outputMin = static_cast<int16_t>(output & 0xFFFF);
+            route.outputMax = static_cast<int16_t>(output >> 16);
+        }
+        mRoutes[i] = route;
+    }
+    _compile();
+}
+
+void ZGMidiMapping::save(TeensyUserInterface &inUI) const {
+    inUI.writeConfigurationInt(EEPROM_ADDRESS, EEPROM_FORMAT);
+    for (int i = 0; i < MAX_ROUTES; i++) {
+        const auto& route = mRoutes[i];
+        auto address = EEPROM_ADDRESS + 5 + i * 15;
+        auto settings = static_cast<uint32_t>(route.feature) | static_cast<uint32_t>(route.destination) << 4 |
+                static_cast<uint32_t>(route.curve) << 8 | static_cast<uint32_t>(route.smoothing) << 12 |
+                static_cast<uint32_t>(route.controller) << 16;
+        auto input = static_cast<uint16_t>(route.inputMin) | static_cast<uint32_t>(static_cast<uint16_t>(route.inputMax)) << 16;
+        auto output = static_cast<uint16_t>(route.outputMin) | static_cast<uint32_t>(static_cast<uint16_t>(route.outputMax)) << 16;
+        inUI.writeConfigurationInt(address, static_cast<int>(settings));
+        inUI.writeConfigurationInt(address + 5, static_cast<int>(input));
+        inUI.writeConfigurationInt(address + 10, static_cast<int>(output));
+    }
+}
+
+void ZGMidiMapping::_compile() {
+    mCompiledCount = 0;
+    for (int i = 0; i < MAX_ROUTES; i++) {
+        const auto& route = mRoutes[i];
+        if (route.destination == MidiDestination::OFF || route.inputMin == route.inputMax) {
+            continue;
+        }
+        auto& compiled = mCompiled[mCompiledCount++];
+        compiled.slot = static_cast<uint8_t>(i);
+        compiled.feature = static_cast<uint8_t>(route.feature);
+        compiled.destination = route.destination;
+        compiled.controller = route.controller;
+        compiled.curve = static_cast<uint8_t>(route.curve);
+        compiled.smoothing = route.smoothing;
+        compiled.inputMin = route.inputMin * 16;
+        compiled.inputScale = static_cast<int32_t>((int64_t{1} << 32) / ((route.inputMax - route.inputMin) * 16));
+        compiled.outputMin = route.outputMin;
+        compiled.outputSpan = route.outputMax - route.outputMin;
+    }
+}
+
+int32_t ZGMidiMapping::_applyCurve(int inCurve, int32_t inValue) const {
+    // 65536 / CURVE_TABLE_SIZE leaves 10 bits between table entries
+    auto index = std::min(inValue >> 10, CURVE_TABLE_SIZE - 1);
+    auto fraction = inValue - (index << 10);
+    const auto* table = mCurveTable[inCurve];
+    return table[index] + (((table[index + 1] - table[index]) * fraction) >> 10);
+}
+
+int32_t ZGMidiMapping::evaluate(const int32_t *inFeatures, int32_t *ioStates, int32_t *outValues) const {
+    auto note_position = NO_NOTE;
+    for (int i = 0; i < mCompiledCount; i++) {
+        const auto& route = mCompiled[i];
+        auto input = static_cast<int32_t>((static_cast<int64_t>(inFeatures[route.feature] - route.inputMin) * route.inputScale) >> 16);
+        input = std::min(std::max(input, 0), 65536);
+
+        auto& state = ioStates[route.slot];
+        auto shaped = _applyCurve(route.curve, input);
+        state = state < 0 ? shaped : state + ((shaped - state) >> route.smoothing);
+
+        outValues[i] = route.outputMin + static_cast<int32_t>((static_cast<int64_t>(state) * route.outputSpan) >> 16);
+        if (route.destination == MidiDestination::NOTE && note_position == NO_NOTE) {
+            note_position = std::min(std::max(outValues[i], 0), 16383) << 2;
+        }
+    }
+    return note_position;
+}
+
+void ZGMidiMapping::send(const int32_t *inValues, int inChannel, bool inSendPitchBend, ZGMidiOutput &inOutput) const {
+    for (int i = 0; i < mCompiledCount; i++) {
+        const auto& route = mCompiled[i];
+        auto value = inValues[i];
+        switch (route.destination) {
+            case MidiDestination::CONTROL_CHANGE:
+                inOutput.sendControlChange(route.controller, std::min(std::max(value, 0), 127), inChannel);
+                break;
+            case MidiDestination::CONTROL_CHANGE_14:
+                inOutput.sendControlChange14(route.controller, std::min(std::max(value, 0), 16383), inChannel);
+                break;
+            case MidiDestination::PITCH_BEND:
+                if (inSendPitchBend) {
+                    inOutput.sendPitchBend(std::min(std::max(value, 0), 16383) - 8192, inChannel);
+                }
+                break;
+            case MidiDestination::PRESSURE:
+                inOutput.sendChannelPressure(std::min(std::max(value, 0), 127), inChannel);
+                break;
+            default:
+                break;
+        }
+    }
+}
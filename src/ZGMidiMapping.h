@@ -0,0 +1,148 @@
+//
+// ZGMidiMapping.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <algorithm>
+#include <TeensyUserInterface.h>
+#include "ZGMidiOutput.h"
+
+#pragma once
+
+enum class MidiFeature : uint8_t {
+    X,              // % of the scan range, -100 to 100
+    Y,              // % of the scan range, -100 to 100
+    ANGLE,          // degrees
+    DISTANCE,       // % of the scan range
+    SPEED,          // cm/s
+    ANGULAR_SPEED,  // degrees/s
+    RADIAL_SPEED,   // cm/s, positive moving away from the sensor
+    CLUSTER_SIZE,   // points
+    TRACK_AGE       // seconds
+};
+
+enum class MidiDestination : uint8_t {
+    OFF,
+    NOTE,               // Position within the scale span, 0-16383
+    CONTROL_CHANGE,     // 0-127
+    CONTROL_CHANGE_14,  // 0-16383 on controller and controller + 32
+    PITCH_BEND,         // 0-16383, 8192 is centered
+    PRESSURE            // 0-127
+};
+
+enum class MidiCurve : uint8_t {
+    LINEAR,
+    EXPONENTIAL,
+    LOGARITHMIC,
+    INVERTED
+};
+
+struct ZGMidiRoute {
+    MidiFeature feature = MidiFeature::ANGLE;
+    MidiDestination destination = MidiDestination::OFF;
+    uint8_t controller = 0;
+    MidiCurve curve = MidiCurve::LINEAR;
+    uint8_t smoothing = 0; // 0 follows immediately, each step halves how fast the output follows the input
+    int16_t inputMin = 0;
+    int16_t inputMax = 0;
+    int16_t outputMin = 0;
+    int16_t outputMax = 0;
+};
+
+/**
+ * @brief Routes tracked object features to MIDI destinations. Routes are compiled into a flat table of fixed point
+ * coefficients whenever they change, so evaluating every route for an object costs a few integer operations each.
+ * Routes are stored in EEPROM through the user interface configuration functions.
+ */
+class ZGMidiMapping {
+public:
+    static constexpr int MAX_ROUTES = 8;
+    static constexpr int FEATURE_COUNT = 9;
+    static constexpr int CURVE_COUNT = 4;
+    static constexpr int32_t NO_NOTE = -1;
+
+    /* */
+    ZGMidiMapping();
+
+    /* */
+    ~ZGMidiMapping();
+
+    /**
+     * @brief Angle to note, distance to a 14 bit mod wheel that rises as objects come closer, speed to timbre (CC 74)
+     * and speed to channel pressure
+     */
+    void setDefaultRoutes();
+
+    /**
+     * @return A route with the natural input range of the feature and the full output range of the destination
+     */
+    static ZGMidiRoute makeRoute(MidiFeature inFeature, MidiDestination inDestination, int inController = 0,
+                                 MidiCurve inCurve = MidiCurve::LINEAR, int inSmoothing = 0);
+
+    const ZGMidiRoute& getRoute(int inIndex) const;
+
+    /**
+     * @brief Replaces a route and recompiles the table
+     */
+    void setRoute(int inIndex, const ZGMidiRoute& inRoute);
+
+    /**
+     * @brief Reads the routes from EEPROM, falling back to the defaults if they were never saved
+     */
+    void load(TeensyUserInterface& inUI);
+
+    void save(TeensyUserInterface& inUI) const;
+
+    /**
+     * @brief Evaluates every route for one object
+     * @param inFeatures Feature values with 4 fractional bits, indexed by MidiFeature
+     * @param ioStates Smoothing state of the object per route slot, MAX_ROUTES long and filled with NO_NOTE before the
+     * first call
+     * @param outValues Output of each route in destination units
+     * @return Position within the scale span with 16 fractional bits from the first note route, or NO_NOTE
+     */
+    int32_t evaluate(const int32_t* inFeatures, int32_t* ioStates, int32_t* outValues) const;
+
+    /**
+     * @brief Queues the controller, pitch bend and pressure outputs of evaluate()
+     * @param inSendPitchBend False when MPE glide owns the channel's pitch bend
+     */
+    void send(const int32_t* inValues, int inChannel, bool inSendPitchBend, ZGMidiOutput& inOutput) const;
+
+    static const char* const featureNames[FEATURE_COUNT];
+
+private:
+
+    static constexpr int EEPROM_ADDRESS = 64;
+    static constexpr int EEPROM_FORMAT = 0x5A4D0001; // Bump when the stored layout changes
+    static constexpr int CURVE_TABLE_SIZE = 64;
+
+    struct CompiledRoute {
+        uint8_t slot;           // Index in mRoutes, smoothing state stays with the route when others are turned off
+        uint8_t feature;
+        MidiDestination destination;
+        uint8_t controller;
+        uint8_t curve;
+        uint8_t smoothing;
+        int32_t inputMin;       // Feature units with 4 fractional bits
+        int32_t inputScale;     // 2^32 / input span, maps the input span to 16 fractional bits
+        int32_t outputMin;
+        int32_t outputSpan;
+    };
+
+    void _compile();
+
+    int32_t _applyCurve(int inCurve, int32_t inValue) const;
+
+    ZGMidiRoute mRoutes[MAX_ROUTES] {};
+    CompiledRoute mCompiled[MAX_ROUTES] {};
+    int mCompiledCount = 0;
+
+    // Every curve sampled at CURVE_TABLE_SIZE + 1 points with 16 fractional bits, interpolated linearly
+    int32_t mCurveTable[CURVE_COUNT][CURVE_TABLE_SIZE + 1] {};
+
+};
@@ -0,0 +1,259 @@
+//
+// ZGMidiOutput.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGMidiOutput.h"
+
+constexpr uint32_t ZGMidiOutput::MAX_QUANTIZE_DELAY;
+
+ZGMidiOutput::ZGMidiOutput(const ZGMidiClock* inClock) {
+    mClock = inClock;
+    memset(mControllerValues, UNKNOWN_VALUE, sizeof(mControllerValues));
+    memset(mPressures, UNKNOWN_VALUE, sizeof(mPressures));
+    for (auto& bend : mPitchBends) {
+        bend = UNKNOWN_BEND;
+    }
+}
+
+ZGMidiOutput::~ZGMidiOutput() = default;
+
+void ZGMidiOutput::setRevolution(uint16_t inRevolution) {
+    mRevolution = inRevolution;
+}
+
+void ZGMidiOutput::setSampleTime(uint32_t inSampleTime) {
+    mSampleTime = inSampleTime;
+}
+
+void ZGMidiOutput::sendNoteOn(int inNote, int inVelocity, int inChannel) {
+    _queueNote(EventType::NOTE_ON, inChannel, inNote, inVelocity);
+}
+
+void ZGMidiOutput::sendNoteOff(int inNote, int inVelocity, int inChannel) {
+    _queueNote(EventType::NOTE_OFF, inChannel, inNote, inVelocity);
+}
+
+void ZGMidiOutput::sendControlChange(int inController, int inValue, int inChannel) {
+    auto& last_value = mControllerValues[(inChannel - 1) & 15][inController & 127];
+    if (last_value == inValue) {
+        mEventsDropped++;
+        return;
+    }
+    last_value = static_cast<int8_t>(inValue);
+    _queue(EventType::CONTROL_CHANGE, inChannel, inController, inValue);
+}
+
+void ZGMidiOutput::sendControlChange14(int inController, int inValue, int inChannel) {
+    auto& controllers = mControllerValues[(inChannel - 1) & 15];
+    auto msb = static_cast<int8_t>((inValue >> 7) & 127);
+    auto lsb = static_cast<int8_t>(inValue & 127);
+    auto& last_msb = controllers[inController & 31];
+    auto& last_lsb = controllers[(inController & 31) + 32];
+    if (last_msb != msb) {
+        // Receivers may clear the LSB when a new MSB arrives, so it always follows
+        last_msb = msb;
+        last_lsb = lsb;
+        _queue(EventType::CONTROL_CHANGE, inChannel, inController & 31, msb);
+        _queue(EventType::CONTROL_CHANGE, inChannel, (inController & 31) + 32, lsb);
+    } else if (last_lsb != lsb) {
+        last_lsb = lsb;
+        _queue(EventType::CONTROL_CHANGE, inChannel, (inController & 31) + 32, lsb);
+    } else {
+        mEventsDropped++;
+    }
+}
+
+void ZGMidiOutput::sendPitchBend(int inValue, int inChannel) {
+    auto& last_bend = mPitchBends[(inChannel - 1) & 15];
+    if (last_bend == inValue) {
+        mEventsDropped++;
+        return;
+    }
+    last_bend = static_cast<int16_t>(inValue);
+    auto unsigned_bend = inValue + 8192;
+    _queue(EventType::PITCH_BEND, inChannel, unsigned_bend & 127, (unsigned_bend >> 7) & 127);
+}
+
+void ZGMidiOutput::sendChannelPressure(int inPressure, int inChannel) {
+    auto& last_pressure = mPressures[(inChannel - 1) & 15];
+    if (last_pressure == inPressure) {
+        mEventsDropped++;
+        return;
+    }
+    last_pressure = static_cast<int8_t>(inPressure);
+    _queue(EventType::CHANNEL_PRESSURE, inChannel, inPressure, 0);
+}
+
+void ZGMidiOutput::sendRegisteredParameter(int inParameter, int inValue, int inChannel) {
+    auto& controllers = mControllerValues[(inChannel - 1) & 15];
+    const int rpn_sequence [6][2] {
+            {101, 0},               // RPN MSB
+            {100, inParameter},     // RPN LSB
+            {6, inValue},           // Data entry MSB
+            {38, 0},                // Data entry LSB
+            {101, 127},             // Null RPN so later data entry is ignored
+            {100, 127}
+    };
+    for (const auto& message : rpn_sequence) {
+        controllers[message[0]] = static_cast<int8_t>(message[1]);
+        _queue(EventType::CONTROL_CHANGE, inChannel, message[0], message[1]);
+    }
+}
+
+void ZGMidiOutput::sendPitchBendRange(int inSemitones, int inChannel) {
+    sendRegisteredParameter(0, inSemitones, inChannel);
+}
+
+ZGMidiOutput::Event ZGMidiOutput::_makeEvent(EventType inType, int inChannel, int inData1, int inData2) const {
+    return Event{inType, static_cast<uint8_t>(inChannel), static_cast<uint8_t>(inData1), static_cast<uint8_t>(inData2),
+                 mRevolution, mSampleTime};
+}
+
+void ZGMidiOutput::_queue(EventType inType, int inChannel, int inData1, int inData2) {
+    auto event = _makeEvent(inType, inChannel, inData1, inData2);
+    // Anything following a held note on the same channel has to wait for it
+    if (mScheduledPerChannel[(inChannel - 1) & 15] > 0) {
+        _schedule(event, mLastScheduledTime);
+        return;
+    }
+    if (mEventCount == MAX_EVENTS) {
+        flush();
+    }
+    mEvents[mEventCount++] = event;
+}
+
+void ZGMidiOutput::_queueNote(EventType inType, int inChannel, int inNote, int inVelocity) {
+    if (mQuantizeGrid > 0) {
+        auto now = micros();
+        auto release_time = mClock->getGridTime(now, mQuantizeGrid, MAX_QUANTIZE_DELAY);
+        if (release_time != now) {
+            _schedule(_makeEvent(inType, inChannel, inNote, inVelocity), release_time);
+            return;
+        }
+    }
+    _queue(inType, inChannel, inNote, inVelocity);
+}
+
+void ZGMidiOutput::_schedule(const Event &inEvent, uint32_t inTime) {
+    if (mScheduledCount == MAX_SCHEDULED_EVENTS) {
+        // Out of room, the oldest held message goes out early rather than being lost
+        auto& oldest = mScheduled[mScheduledHead];
+        _releaseScheduled(oldest.time, false);
+    }
+    // Keep release times in order so a later message never overtakes an earlier one
+    if (mScheduledCount > 0 && static_cast<int32_t>(inTime - mLastScheduledTime) < 0) {
+        inTime = mLastScheduledTime;
+    }
+    mScheduled[(mScheduledHead + mScheduledCount) % MAX_SCHEDULED_EVENTS] = ScheduledEvent{inEvent, inTime};
+    mScheduledCount++;
+    mScheduledPerChannel[(inEvent.channel - 1) & 15]++;
+    mLastScheduledTime = inTime;
+}
+
+void ZGMidiOutput::_releaseScheduled(uint32_t inTime, bool inReleaseAll) {
+    while (mScheduledCount > 0) {
+        const auto& scheduled = mScheduled[mScheduledHead];
+        if (!inReleaseAll && static_cast<int32_t>(inTime - scheduled.time) < 0) {
+            break;
+        }
+        mScheduledPerChannel[(scheduled.event.channel - 1) & 15]--;
+        mScheduledHead = (mScheduledHead + 1) % MAX_SCHEDULED_EVENTS;
+        mScheduledCount--;
+        if (mEventCount == MAX_EVENTS) {
+            flush();
+        }
+        mEvents[mEventCount++] = scheduled.event;
+    }
+}
+
+void ZGMidiOutput::update() {
+    if (mScheduledCount == 0) {
+        return;
+    }
+    auto now = micros();
+    auto release_all = !mClock->isRunning(now);
+    if (release_all || static_cast<int32_t>(now - mScheduled[mScheduledHead].time) >= 0) {
+        _releaseScheduled(now, release_all);
+        flush();
+    }
+}
+
+void ZGMidiOutput::setQuantizeGrid(int inTicksPerStep) {
+    mQuantizeGrid = inTicksPerStep;
+    if (mQuantizeGrid == 0) {
+        _releaseScheduled(micros(), true);
+        flush();
+    }
+}
+
+const int &ZGMidiOutput::getQuantizeGrid() const {
+    return mQuantizeGrid;
+}
+
+void ZGMidiOutput::flush() {
+    for (int i = 0; i < mEventCount; i++) {
+        const auto& event = mEvents[i];
+        switch (event.type) {
+            case EventType::NOTE_ON:
+                usbMIDI.sendNoteOn(event.data1, event.data2, event.channel);
+                break;
+            case EventType::NOTE_OFF:
+                usbMIDI.sendNoteOff(event.data1, event.data2, event.channel);
+                break;
+            case EventType::CONTROL_CHANGE:
+                usbMIDI.sendControlChange(event.data1, event.data2, event.channel);
+                break;
+            case EventType::PITCH_BEND:
+                usbMIDI.sendPitchBend(((event.data2 << 7) | event.data1) - 8192, event.channel);
+                break;
+            case EventType::CHANNEL_PRESSURE:
+                usbMIDI.sendAfterTouch(event.data1, event.channel);
+                break;
+        }
+    }
+    if (mEventCount > 0) {
+        usbMIDI.send_now();
+    }
+
+    auto send_time = micros();
+    for (int i = 0; i < mEventCount; i++) {
+        const auto& event = mEvents[i];
+        mTrace.record(_getStatus(event), event.data1, event.data2, event.revolution, event.sampleTime, send_time);
+    }
+    mBytesSent += mEventCount * BYTES_PER_EVENT;
+    mEventCount = 0;
+
+    _updateLogs();
+}
+
+uint8_t ZGMidiOutput::_getStatus(const Event &inEvent) {
+    // Indexed by EventType
+    const uint8_t status_bytes [5] {0x90, 0x80, 0xB0, 0xE0, 0xD0};
+    return status_bytes[static_cast<int>(inEvent.type)] | ((inEvent.channel - 1) & 15);
+}
+
+void ZGMidiOutput::_updateLogs() {
+    if (mLogTimer >= 1000) {
+        mBytesPerSecond = mBytesSent;
+        mEventsDroppedPerSecond = mEventsDropped;
+        mBytesSent = 0;
+        mEventsDropped = 0;
+        mLogTimer = 0;
+    }
+}
+
+const ZGMidiTrace &ZGMidiOutput::getTrace() const {
+    return mTrace;
+}
+
+const int &ZGMidiOutput::getBytesPerSecond() const {
+    return mBytesPerSecond;
+}
+
+const int &ZGMidiOutput::getEventsDroppedPerSecond() const {
+    return mEventsDroppedPerSecond;
+}
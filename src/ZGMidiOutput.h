@@ -0,0 +1,199 @@
+//
+// ZGMidiOutput.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include "ZGMidiClock.h"
+#include "ZGMidiTrace.h"
+
+#pragma once
+
+/**
+ * @brief Central MIDI output stage. Tracked objects queue their messages here during a revolution and the tracker flushes
+ * the queue once the revolution is processed, so every message of a revolution goes out back to back in full USB
+ * packets. Controller values that match what was last sent on the channel are dropped before they are queued.
+ *
+ * With a quantize grid set and MIDI clock running, notes are held in a timestamped schedule until the next grid line.
+ * Everything sent on a channel after a held note waits behind it, so each channel keeps its message order.
+ *
+ * Every message carries the revolution and lidar sample time it was queued under and is logged to a ZGMidiTrace when
+ * sent, so the delay from sample to USB can be audited per message.
+ */
+class ZGMidiOutput {
+public:
+    static constexpr uint32_t MAX_QUANTIZE_DELAY = 150000; // Notes further than this from the next grid line play right away
+
+    /**
+     * @param inClock Incoming MIDI clock that note quantization follows
+     */
+    explicit ZGMidiOutput(const ZGMidiClock* inClock);
+
+    /* */
+    ~ZGMidiOutput();
+
+    /**
+     * @brief Sets the revolution that messages queued from now on belong to
+     */
+    void setRevolution(uint16_t inRevolution);
+
+    /**
+     * @brief Sets the lidar sample time that caused the messages queued from now on
+     * @param inSampleTime micros() when the samples were read, 0 for messages that no sample caused
+     */
+    void setSampleTime(uint32_t inSampleTime);
+
+    void sendNoteOn(int inNote, int inVelocity, int inChannel);
+
+    void sendNoteOff(int inNote, int inVelocity, int inChannel);
+
+    /**
+     * @brief Queues a control change unless the controller already has this value on the channel
+     */
+    void sendControlChange(int inController, int inValue, int inChannel);
+
+    /**
+     * @brief Queues a 14 bit controller as an MSB/LSB pair. The LSB follows every changed MSB, when only the LSB changed
+     * it is sent on its own
+     * @param inController MSB controller number 0-31, the LSB goes to inController + 32
+     * @param inValue 0-16383
+     */
+    void sendControlChange14(int inController, int inValue, int inChannel);
+
+    /**
+     * @brief Queues a pitch bend unless the channel is already bent by this amount
+     * @param inValue -8192 to 8191, 0 is centered
+     */
+    void sendPitchBend(int inValue, int inChannel);
+
+    /**
+     * @brief Queues channel pressure unless the channel already has this pressure
+     */
+    void sendChannelPressure(int inPressure, int inChannel);
+
+    /**
+     * @brief Queues a registered parameter number with a data entry MSB, then deselects the RPN. Never suppressed
+     * @param inParameter RPN 0-127, eg. 0 for pitch bend sensitivity or 6 for the MPE Configuration Message
+     */
+    void sendRegisteredParameter(int inParameter, int inValue, int inChannel);
+
+    /**
+     * @brief Queues RPN 0 to set the pitch bend sensitivity of a channel
+     * @param inSemitones Bend range in either direction
+     */
+    void sendPitchBendRange(int inSemitones, int inChannel);
+
+    /**
+     * @brief Sends every queued message and pushes the partially filled USB packet out with send_now(). Scheduled
+     * messages stay held until update() finds them due
+     */
+    void flush();
+
+    /**
+     * @brief Called every loop to send scheduled messages as they become due between revolutions
+     */
+    void update();
+
+    /**
+     * @param inTicksPerStep Grid spacing in MIDI clock ticks, 0 sends notes as soon as they are flushed
+     */
+    void setQuantizeGrid(int inTicksPerStep);
+
+    const int& getQuantizeGrid() const;
+
+    /**
+     * @return Every message sent recently with its sample and send time
+     */
+    const ZGMidiTrace& getTrace() const;
+
+    /**
+     * @return USB MIDI bytes sent during the last full second
+     */
+    const int& getBytesPerSecond() const;
+
+    /**
+     * @return Messages dropped as duplicates during the last full second
+     */
+    const int& getEventsDroppedPerSecond() const;
+
+private:
+
+    enum class EventType : uint8_t {
+        NOTE_ON,
+        NOTE_OFF,
+        CONTROL_CHANGE,
+        PITCH_BEND,
+        CHANNEL_PRESSURE
+    };
+
+    struct Event {
+        EventType type;
+        uint8_t channel;
+        uint8_t data1;
+        uint8_t data2;
+        uint16_t revolution;
+        uint32_t sampleTime;
+    };
+
+    struct ScheduledEvent {
+        Event event;
+        uint32_t time;
+    };
+
+    static constexpr int MAX_EVENTS = 256;
+    static constexpr int MAX_SCHEDULED_EVENTS = 128;
+    static constexpr int BYTES_PER_EVENT = 4; // USB MIDI event packet
+    static constexpr int8_t UNKNOWN_VALUE = -1;
+    static constexpr int16_t UNKNOWN_BEND = INT16_MIN;
+
+    void _queue(EventType inType, int inChannel, int inData1, int inData2);
+
+    Event _makeEvent(EventType inType, int inChannel, int inData1, int inData2) const;
+
+    static uint8_t _getStatus(const Event& inEvent);
+
+    /**
+     * @brief Queues a note, holding it until the next grid line when quantizing
+     */
+    void _queueNote(EventType inType, int inChannel, int inNote, int inVelocity);
+
+    void _schedule(const Event& inEvent, uint32_t inTime);
+
+    /**
+     * @param inReleaseAll Moves every scheduled message regardless of its time, used when the clock stops
+     */
+    void _releaseScheduled(uint32_t inTime, bool inReleaseAll);
+
+    void _updateLogs();
+
+    Event mEvents[MAX_EVENTS] {};
+    int mEventCount = 0;
+
+    uint16_t mRevolution = 0;
+    uint32_t mSampleTime = 0;
+    ZGMidiTrace mTrace {};
+
+    // Release times never decrease, so the schedule is a FIFO ring
+    const ZGMidiClock* mClock;
+    ScheduledEvent mScheduled[MAX_SCHEDULED_EVENTS] {};
+    int mScheduledHead = 0;
+    int mScheduledCount = 0;
+    uint8_t mScheduledPerChannel[16] {};
+    uint32_t mLastScheduledTime = 0;
+    int mQuantizeGrid = 0;
+
+    // Last value sent for every controller of every channel, -1 until first sent
+    int8_t mControllerValues[16][128];
+    int16_t mPitchBends[16];
+    int8_t mPressures[16];
+
+    elapsedMillis mLogTimer = 0;
+    int mBytesSent = 0;
+    int mEventsDropped = 0;
+    int mBytesPerSecond = 0;
+    int mEventsDroppedPerSecond = 0;
+
+};
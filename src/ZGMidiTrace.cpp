@@ -0,0 +1,43 @@
+//
+// ZGMidiTrace.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGMidiTrace.h"
+
+ZGMidiTrace::ZGMidiTrace() = default;
+
+ZGMidiTrace::~ZGMidiTrace() = default;
+
+void ZGMidiTrace::record(uint8_t inStatus, uint8_t inData1, uint8_t inData2, uint16_t inRevolution,
+                         uint32_t inSampleTime, uint32_t inSendTime) {
+    mEntries[mRecordedCount % CAPACITY] = Entry{inSampleTime, inSendTime, inRevolution, inStatus, inData1, inData2};
+    mRecordedCount++;
+}
+
+void ZGMidiTrace::writeCSV(Print &inOutput) const {
+    inOutput.println("revolution,status,data1,data2,sample_us,send_us");
+    auto count = std::min<uint32_t>(mRecordedCount, CAPACITY);
+    auto first = mRecordedCount - count;
+    for (uint32_t i = first; i < mRecordedCount; i++) {
+        const auto& entry = mEntries[i % CAPACITY];
+        inOutput.print(entry.revolution);
+        inOutput.print(',');
+        inOutput.print(entry.status);
+        inOutput.print(',');
+        inOutput.print(entry.data1);
+        inOutput.print(',');
+        inOutput.print(entry.data2);
+        inOutput.print(',');
+        inOutput.print(entry.sampleTime);
+        inOutput.print(',');
+        inOutput.println(entry.sendTime);
+    }
+}
+
+const uint32_t &ZGMidiTrace::getRecordedCount() const {
+    return mRecordedCount;
+}
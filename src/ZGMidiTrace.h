@@ -0,0 +1,62 @@
+//
+// ZGMidiTrace.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+
+#pragma once
+
+/**
+ * @brief Fixed size ring of every MIDI message sent, each with the lidar sample time that caused it and the time it was
+ * handed to USB. Once full the oldest entries are overwritten, so the trace always covers the last CAPACITY messages.
+ * Dumped as CSV for tools/midi_trace_latency.py.
+ */
+class ZGMidiTrace {
+public:
+    static constexpr int CAPACITY = 2048;
+
+    /* */
+    ZGMidiTrace();
+
+    /* */
+    ~ZGMidiTrace();
+
+    /**
+     * @param inStatus MIDI status byte including the channel, eg. 0x90 for a note on on channel 1
+     * @param inRevolution Lidar revolution the message was generated in
+     * @param inSampleTime micros() when the lidar samples behind the message were read, 0 if no sample caused it
+     * @param inSendTime micros() when the message was sent
+     */
+    void record(uint8_t inStatus, uint8_t inData1, uint8_t inData2, uint16_t inRevolution, uint32_t inSampleTime,
+                uint32_t inSendTime);
+
+    /**
+     * @brief Writes the trace oldest first as CSV with a header line
+     * @param inOutput Any Arduino Print such as Serial or an SD File
+     */
+    void writeCSV(Print& inOutput) const;
+
+    /**
+     * @return Messages recorded since startup, including ones that have been overwritten
+     */
+    const uint32_t& getRecordedCount() const;
+
+private:
+
+    struct Entry {
+        uint32_t sampleTime;
+        uint32_t sendTime;
+        uint16_t revolution;
+        uint8_t status;
+        uint8_t data1;
+        uint8_t data2;
+    };
+
+    Entry mEntries[CAPACITY] {};
+    uint32_t mRecordedCount = 0;
+
+};
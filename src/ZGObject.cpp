@@ -8,55 +8,57 @@
 
 #include "ZGObject.h"
 
-namespace {
-    bool isChannelAssigned[15] {
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false,
-        false
-    };
-}
-
-ZGObject::ZGObject(float inX, float inY, int inRoot, int inScaleType, float inDistance) {
-    mX = inX;
-    mY = inY;
-    updateRootNote(inRoot);
-    updateScaleType(inScaleType);
+constexpr uint32_t ZGObject::MAX_PREDICTION;
+
+ZGObject::ZGObject(ZGPoint inPoint, int inClusterSize, float inDistance, int inPitchBendRange,
+                   const ZGScaleQuantizer* inScaleQuantizer, const ZGMidiMapping* inMidiMapping,
+                   ZGMidiOutput* inMidiOutput, ZGVoiceAllocator* inVoiceAllocator) {
+    mScaleQuantizer = inScaleQuantizer;
+    mMidiMapping = inMidiMapping;
+    mClusterSize = inClusterSize;
+    for (auto& state : mRouteStates) {
+        state = ZGMidiMapping::NO_NOTE;
+    }
+    mMidiOutput = inMidiOutput;
+    mVoiceAllocator = inVoiceAllocator;
+    mX = inPoint.x;
+    mY = inPoint.y;
+    mSampleTime = inPoint.time;
     updateDistance(inDistance);
-    if (_assignMidiChannel()) {
-        auto polar = ZGConversionHelpers::cartesianToPolar(inX, inY);
-        mAngle = polar.angle;
-        mDistance = polar.distance;
+    updatePitchBendRange(inPitchBendRange);
+    // A stolen voice is turned off on behalf of this object
+    mMidiOutput->setSampleTime(mSampleTime);
+    _assignMidiChannel();
 
-        mSpeedTracker = 0;
+    auto polar = ZGConversionHelpers::cartesianToPolar(inPoint.x, inPoint.y);
+    mAngle = polar.angle;
+    mDistance = polar.distance;
 
-        _playMidi();
-    }
+    mSpeedTracker = 0;
+    mAge = 0;
+
+    _playMidi();
 }
 
 ZGObject::~ZGObject() = default;
 
-void ZGObject::updatePoint(ZGPoint inPoint) {
+void ZGObject::updatePoint(ZGPoint inPoint, int inClusterSize) {
     auto polar = ZGConversionHelpers::cartesianToPolar(inPoint);
-    auto cart_distance = std::hypot(inPoint.x - mX, inPoint.y - mY);
+    auto cart_distance = std::sqrt((inPoint.x - mX) * (inPoint.x - mX) + (inPoint.y - mY) * (inPoint.y - mY));
     auto angle_distance = polar.angle - mAngle;
     auto distance = polar.distance - mDistance;
+    auto sample_period = inPoint.time - mSampleTime;
+    if (sample_period > 0) {
+        mVelocityX = (inPoint.x - mX) * 1e6f / static_cast<float>(sample_period);
+        mVelocityY = (inPoint.y - mY) * 1e6f / static_cast<float>(sample_period);
+    }
 
     mX = inPoint.x;
     mY = inPoint.y;
     mAngle = polar.angle;
     mDistance = polar.distance;
+    mClusterSize = inClusterSize;
+    mSampleTime = inPoint.time;
     mRemoveFlag = false;
 
     if (mSpeedTracker != 0) {
@@ -74,57 +76,101 @@ void ZGObject::flagForRemoval(bool inShouldRemove) {
     mRemoveFlag = inShouldRemove;
 }
 
-const bool & ZGObject::requestToRemove() const {
-    if (mRemoveFlag) {
-        usbMIDI.sendNoteOff(currentMidiNote, 127, mMidiChannel);
+bool ZGObject::requestToRemove() const {
+    auto has_voice = mVoiceAllocator->isOwner(mMidiChannel, mVoiceId);
+    if (mRemoveFlag && has_voice) {
+        mMidiOutput->sendNoteOff(currentMidiNote, 127, mMidiChannel);
         _releaseMidiChannel();
     }
-    return mRemoveFlag;
+    // A stolen voice has already been turned off by the allocator
+    return mRemoveFlag || !has_voice;
 }
 
-bool ZGObject::_assignMidiChannel() {
-    for (int i = 0; i < 15; i++){
-        if (!isChannelAssigned[i]) {
-            isChannelAssigned[i] = true;
-            mMidiChannel = i + 2;
-            return true;
-        }
-    }
-    flagForRemoval(true);
-    return false;
-
+void ZGObject::_assignMidiChannel() {
+    mMidiChannel = mVoiceAllocator->allocate(mVoiceId);
 }
 
 void ZGObject::_releaseMidiChannel() const {
-    if (mMidiChannel < 2){
-        return;
-    } else {
-        isChannelAssigned[mMidiChannel - 2] = false;
+    mVoiceAllocator->release(mMidiChannel, mVoiceId);
+}
+
+void ZGObject::_calculateFeatures(int32_t* outFeatures) const {
+    auto percent = 100.f / mMaxDistance;
+    // Indexed by MidiFeature, speeds are tracked per 100ms
+    const float features [ZGMidiMapping::FEATURE_COUNT] {
+            mX * percent,
+            mY * percent,
+            mAngle,
+            mDistance * percent,
+            mSpeed * 10.f,
+            mAngleSpeed * 10.f,
+            mDistanceSpeed * 10.f,
+            static_cast<float>(mClusterSize),
+            static_cast<float>(mAge) / 1000.f
+    };
+    for (int i = 0; i < ZGMidiMapping::FEATURE_COUNT; i++) {
+        outFeatures[i] = static_cast<int32_t>(features[i] * 16.f);
     }
 }
 
-void ZGObject::_calculateMidi(){
-    auto degree = static_cast<int>(mAngle * midi_factor);
-    if (mScaleType == 1) {
-        degree = ZGConversionHelpers::convertToMajor(degree);
-    } else if (mScaleType == 2) {
-        degree = ZGConversionHelpers::convertToMinor(degree);
+void ZGObject::_calculateExpression(int32_t inPosition){
+    auto position = inPosition * mScaleQuantizer->getDegreeCount();
+    auto degree = position >> 16;
+    auto fraction = position & 0xFFFF;
+    auto note = mScaleQuantizer->getDegreeNote(degree);
+    auto next_note = mScaleQuantizer->getDegreeNote(degree + 1);
+
+    // Pitch in semitones with 16 fractional bits, gliding linearly towards the next degree
+    auto target_pitch = (note << 16) + fraction * (next_note - note);
+
+    // Hold the sounding note while the glide stays inside the bend range, retrigger on the current degree otherwise
+    newMidiNote = currentMidiNote;
+    auto bend = target_pitch - (currentMidiNote << 16);
+    if (std::abs(bend) > (mPitchBendRange << 16)) {
+        newMidiNote = note;
+        bend = target_pitch - (note << 16);
     }
-    newMidiNote = degree + mRootNote;
-    modValue = 127 - static_cast<int>(mDistance * mod_factor);
-    timbreValue = static_cast<int>(mSpeed * 64.f / 70.f) + 63;
+    // Full range is 8192 steps, 65536 / 8192 leaves a shift of 3
+    pitchBendValue = std::min(std::max((bend / mPitchBendRange) >> 3, -8192), 8191);
 }
 
 void ZGObject::_playMidi(){
-    _calculateMidi();
+    if (!mVoiceAllocator->isOwner(mMidiChannel, mVoiceId)) {
+        return;
+    }
+
+    mMidiOutput->setSampleTime(mSampleTime);
+
+    int32_t features [ZGMidiMapping::FEATURE_COUNT];
+    int32_t route_values [ZGMidiMapping::MAX_ROUTES];
+    _calculateFeatures(features);
+    auto position = mMidiMapping->evaluate(features, mRouteStates, route_values);
+
+    auto expressive = mPitchBendRange != 0;
+    if (position != ZGMidiMapping::NO_NOTE) {
+        if (expressive) {
+            _calculateExpression(position);
+        } else {
+            newMidiNote = mScaleQuantizer->getNote(position);
+        }
+    }
 
-    if (newMidiNote != currentMidiNote) {
-        usbMIDI.sendNoteOff(currentMidiNote, 127, mMidiChannel);
+    // MPE expects the channel's bend and controllers to be in place before the note starts
+    auto retrigger = newMidiNote != currentMidiNote;
+    if (retrigger) {
+        mMidiOutput->sendNoteOff(currentMidiNote, 127, mMidiChannel);
+    }
+    if (expressive) {
+        mMidiOutput->sendPitchBend(pitchBendValue, mMidiChannel);
+    }
+    mMidiMapping->send(route_values, mMidiChannel, !expressive, *mMidiOutput);
+    if (retrigger) {
         currentMidiNote = newMidiNote;
-        usbMIDI.sendNoteOn(currentMidiNote, 127, mMidiChannel);
+        mMidiOutput->sendNoteOn(currentMidiNote, 127, mMidiChannel);
     }
-    usbMIDI.sendControlChange( 1, modValue, mMidiChannel);
-    usbMIDI.sendControlChange(74, timbreValue, mMidiChannel);
+
+    auto level = std::min(static_cast<int>(mSpeed * 127.f / 70.f), 127);
+    mVoiceAllocator->updateVoice(mMidiChannel, mVoiceId, currentMidiNote, level, mDistance);
 }
 
 const float &ZGObject::getX() const {
@@ -139,19 +185,15 @@ ZGPoint ZGObject::getPoint() const {
     return ZGPoint{mX, mY};
 }
 
-void ZGObject::updateRootNote(int inNewRoot) {
-    mRootNote = inNewRoot + 48;
+ZGPoint ZGObject::getPredictedPoint(uint32_t inTime) const {
+    auto elapsed = std::min(inTime - mSampleTime, MAX_PREDICTION) * 1e-6f;
+    return ZGPoint{mX + mVelocityX * elapsed, mY + mVelocityY * elapsed};
 }
 
-void ZGObject::updateScaleType(int inNewType) {
-    if (inNewType == 0){
-        midi_factor = 12. / 360.;
-    } else {
-        midi_factor = 7. / 360.;
-    }
-    mScaleType = inNewType;
+void ZGObject::updateDistance(float inNewDistance) {
+    mMaxDistance = inNewDistance;
 }
 
-void ZGObject::updateDistance(float inNewDistance) {
-    mod_factor = 127.f / inNewDistance;
+void ZGObject::updatePitchBendRange(int inSemitones) {
+    mPitchBendRange = inSemitones;
 }
@@ -9,16 +9,25 @@
 #pragma once
 #include <Arduino.h>
 #include "ZGConversionHelpers.h"
+#include "ZGMidiOutput.h"
+#include "ZGVoiceAllocator.h"
+#include "ZGScaleQuantizer.h"
+#include "ZGMidiMapping.h"
 
 
 class ZGObject {
 public:
 
-    ZGObject(float inX, float inY, int inRoot, int inScaleType, float inDistance);
+    /**
+     * @param inPoint Cluster center, its time is the sample time that MIDI sent for the object is traced under
+     */
+    ZGObject(ZGPoint inPoint, int inClusterSize, float inDistance, int inPitchBendRange,
+             const ZGScaleQuantizer* inScaleQuantizer, const ZGMidiMapping* inMidiMapping,
+             ZGMidiOutput* inMidiOutput, ZGVoiceAllocator* inVoiceAllocator);
 
     ~ZGObject();
 
-    void updatePoint(ZGPoint inPoint);
+    void updatePoint(ZGPoint inPoint, int inClusterSize);
 
     const float& getX() const;
 
@@ -26,46 +35,75 @@ public:
 
     ZGPoint getPoint() const;
 
-    void flagForRemoval(bool inShouldRemove);
+    /**
+     * @return Position extrapolated from the last update to inTime with the measured velocity, at most
+     * MAX_PREDICTION microseconds ahead
+     */
+    ZGPoint getPredictedPoint(uint32_t inTime) const;
 
-    const bool& requestToRemove() const;
+    void flagForRemoval(bool inShouldRemove);
 
-    void updateRootNote(int inNewRoot);
+    /**
+     * @brief Sends the note off and frees the channel when the object is flagged for removal
+     * @return True if the object should be removed, either because it was flagged or because its voice was stolen
+     */
+    bool requestToRemove() const;
 
     void updateDistance(float inNewDistance);
 
-    void updateScaleType(int inNewType);
+    /**
+     * @param inSemitones 0 sends quantized notes. Any other value sends MPE expression: notes glide between scale
+     * degrees with per channel pitch bend over this range, and pitch bend routes of the MIDI mapping are ignored
+     */
+    void updatePitchBendRange(int inSemitones);
 
 private:
 
+    static constexpr uint32_t MAX_PREDICTION = 200000;
+
     float mX = 0;
     float mY = 0;
     float mSpeed = 0;
+    float mVelocityX = 0;   // cm per second
+    float mVelocityY = 0;
     float mAngle = 0;
     float mAngleSpeed = 0;
     float mDistance = 0;
     float mDistanceSpeed = 0;
+    float mMaxDistance = 150.f;
+    int mClusterSize = 0;
+    uint32_t mSampleTime = 0; // micros() when the latest sample of the object was read
     bool mRemoveFlag = false;
 
     elapsedMillis mSpeedTracker = 0;
+    elapsedMillis mAge = 0;
 
-    double midi_factor = 12. / 360.;
-    float mod_factor = 127.f / 150.f;
+    int mPitchBendRange = 0;
 
     //MIDI
+    const ZGScaleQuantizer* mScaleQuantizer;
+    const ZGMidiMapping* mMidiMapping;
+    int32_t mRouteStates[ZGMidiMapping::MAX_ROUTES];
+    ZGMidiOutput* mMidiOutput;
+    ZGVoiceAllocator* mVoiceAllocator;
+    uint32_t mVoiceId = 0;
     int currentMidiNote = 0;
     int newMidiNote = 0;
     int mMidiChannel = 1;
-    int modValue = 0;
-    int timbreValue = 63;
+    int pitchBendValue = 0;
 
-    int mRootNote = 48; //C3
-    int mScaleType = 0; //Chromatic
-
-    bool _assignMidiChannel();
+    void _assignMidiChannel();
     void _releaseMidiChannel() const;
 
-    void _calculateMidi();
+    /**
+     * @param outFeatures Filled with every MidiFeature with 4 fractional bits
+     */
+    void _calculateFeatures(int32_t* outFeatures) const;
+
+    /**
+     * @brief Finds the note and pitch bend for an MPE glide to a position within the scale span
+     */
+    void _calculateExpression(int32_t inPosition);
 
     void _playMidi();
 
@@ -9,58 +9,41 @@
 #include <unordered_map>
 #include "ZGObjectTracker.h"
 
-ZGObjectTracker::ZGObjectTracker() = default;
-
-ZGObjectTracker::~ZGObjectTracker() = default;
-
-void ZGObjectTracker::processBuffer(std::vector<ZGPolarData>& inBuffer)
-{
-    mClusters.clear();
-    _segmentPointCloud(inBuffer);
-    _updateTrackedObjects();
-    inBuffer.clear();
+ZGObjectTracker::ZGObjectTracker() {
+    mOccupancyGrid.reset(mMaxDistance);
+    mRegion.setMaxDistance(mMaxDistance);
+    mSegmenter.setMaxDistance(mMaxDistance);
 }
 
-void ZGObjectTracker::_segmentPointCloud(std::vector<ZGPolarData>& inBuffer) {
-    mPointBuffer.clear();
-    for (auto point : inBuffer) {
-        auto angle = point.angle;
-        auto distance = point.distance;
-        if (distance <= mMaxDistance) {
-            ZGPoint p = ZGConversionHelpers::polarToCartesian(angle, distance); // Convert polar to Cartesian coordinates
-            mPointBuffer.push_back(p);
-        }
-    }
-
-    if (USE_DBSCAN_METHOD) {
-        _dbScan();
-    } else {
-        _euclideanScan();
-    }
-
-}
+ZGObjectTracker::~ZGObjectTracker() = default;
 
-ZGPoint ZGObjectTracker::_findClusterAverage(const std::vector<ZGPoint> &inCluster)
+void ZGObjectTracker::processBuffer(ZGRangeImage& inImage)
 {
-    auto sumX = 0.f;
-    auto sumY = 0.f;
-
-    for (const auto& point : inCluster) {
-        sumX += point.x;
-        sumY += point.y;
+    auto start = micros();
+    mRevolution++;
+    mMidiOutput.setRevolution(mRevolution);
+    const auto level = mComputeBudget.getLevel();
+    // Distance mode is the cheapest segmentation, used instead of DBSCAN while over budget
+    auto scan_mode = level >= ComputeLevel::SEGMENTED ? ScanMode::DISTANCE : mScanMode;
+    const auto active_sectors = level >= ComputeLevel::SECTORED ? _getActiveSectors() : ~0u;
+    auto voxel_size = mVoxelSize;
+    if (level >= ComputeLevel::DOWNSAMPLED) {
+        voxel_size = std::max(voxel_size, ZGDensityTable::getMaxCellSize());
     }
+    mRevolutionTime = inImage.getSampleCount() == 0 ? micros() : inImage.getLastSampleTime();
+    mSegmenter.segment(inImage, active_sectors, voxel_size, scan_mode);
+    _updateTrackedObjects();
+    mMidiOutput.flush();
+    _updateOccupancyGrid();
+    inImage.clear();
 
-    auto avgX = sumX / static_cast<float>(inCluster.size());
-    auto avgY = sumY / static_cast<float>(inCluster.size());
-    ZGPoint p {avgX, avgY};
-
-    return  p;
-
+    mComputeBudget.update(micros() - start, mLastProcessStart == 0 ? 0 : start - mLastProcessStart);
+    mLastProcessStart = start;
 }
 
-const std::vector<std::vector<ZGPoint>> &ZGObjectTracker::getClusters() const
+const ZGClusterSet &ZGObjectTracker::getClusters() const
 {
-    return mClusters;
+    return mSegmenter.getClusters();
 }
 
 void ZGObjectTracker::_updateTrackedObjects()
@@ -70,155 +53,99 @@ void ZGObjectTracker::_updateTrackedObjects()
         object.flagForRemoval(true);
     }
 
-    // Step through found clusters
-    for(const auto& cluster : mClusters) {
-        auto center = _findClusterAverage(cluster);
+    // Step through found people
+    mPersonDetector.detect(mSegmenter.getClusters());
+    for(const auto& detection : mPersonDetector.getDetections()) {
+        const auto& center = detection.center;
         auto found_match = false;
         // Try to match to an existing object;
         for (auto& object : mTrackedObjects) {
-            auto distance = std::hypot(center.x - object.getX(), center.y - object.getY());
-            if (distance <= mMaxClusterDistance) {
-                object.updatePoint(center);
+            auto dx = center.x - object.getX();
+            auto dy = center.y - object.getY();
+            if (dx * dx + dy * dy <= ZGClusterer::CLUSTER_DISTANCE * ZGClusterer::CLUSTER_DISTANCE) {
+                object.updatePoint(center, detection.count);
                 found_match = true;
                 break;
             }
         }
         // If we don't find a match we add a new tracked object;
         if (!found_match) {
-            ZGObject new_object(center.x, center.y, mRootNote, mScaleType, mMaxDistance);
+            ZGObject new_object(center, detection.count, mMaxDistance, mPitchBendRange,
+                                &mScaleQuantizer, &mMidiMapping, &mMidiOutput, &mVoiceAllocator);
             mTrackedObjects.push_back(new_object);
         }
     }
 
+    // Objects are removed because nothing was found in this revolution, so the whole revolution caused it
+    mMidiOutput.setSampleTime(mRevolutionTime);
+
     // Remove objects that didn't find a match by flag
     mTrackedObjects.erase(std::remove_if(mTrackedObjects.begin(), mTrackedObjects.end(), [](const ZGObject& e){ return e.requestToRemove(); }),
               mTrackedObjects.end());
 }
 
+void ZGObjectTracker::processMidiInput()
+{
+    while (usbMIDI.read()) {
+        mMidiClock.processMessage(usbMIDI.getType(), usbMIDI.getData1(), usbMIDI.getData2(), micros());
+    }
+    mMidiOutput.update();
+}
+
 const std::vector<ZGObject> &ZGObjectTracker::getObjects() const
 {
     return mTrackedObjects;
 }
 
-using namespace std;
-vector<int> ZGObjectTracker::_calculateCluster(ZGPoint point)
+void ZGObjectTracker::_updateOccupancyGrid()
 {
-    int index = 0;
-    vector<ZGPoint>::iterator iter;
-    vector<int> clusterIndex;
-    for( iter = mPointBuffer.begin(); iter != mPointBuffer.end(); ++iter)
-    {
-        if ( ZGConversionHelpers::getDistance(point, *iter) <= mEpsilon )
-        {
-            clusterIndex.push_back(index);
+    mOccupancyGrid.decay();
+    for (const auto& cluster : mSegmenter.getClusters()) {
+        for (const auto& point : cluster) {
+            mOccupancyGrid.addPoint(point);
         }
-        index++;
     }
-    return clusterIndex;
 }
 
-int ZGObjectTracker::_expandCluster(ZGPoint& inPoint, int clusterID)
+const ZGOccupancyGrid &ZGObjectTracker::getOccupancyGrid() const
 {
-    vector<int> clusterSeeds = _calculateCluster(inPoint);
+    return mOccupancyGrid;
+}
 
-    if ( clusterSeeds.size() < mMinPointsPerCluster )
-    {
-        inPoint.clusterID = static_cast<int>(ClusterID::NOISE);
-        return static_cast<int>(ClusterID::ERROR);
-    }
-    else
-    {
-        int index = 0, indexCorePoint = 0;
-        vector<int>::iterator iterSeeds;
-        for( iterSeeds = clusterSeeds.begin(); iterSeeds != clusterSeeds.end(); ++iterSeeds)
-        {
-            mPointBuffer.at(*iterSeeds).clusterID = clusterID;
-            if (mPointBuffer.at(*iterSeeds).x == inPoint.x && mPointBuffer.at(*iterSeeds).y == inPoint.y )
-            {
-                indexCorePoint = index;
-            }
-            ++index;
-        }
-        clusterSeeds.erase(clusterSeeds.begin()+indexCorePoint);
-
-        for( vector<int>::size_type i = 0, n = clusterSeeds.size(); i < n; ++i )
-        {
-            vector<int> clusterNeighbors = _calculateCluster(mPointBuffer.at(clusterSeeds[i]));
-
-            if (clusterNeighbors.size() >= mMinPointsPerCluster )
-            {
-                vector<int>::iterator iterNeighbors;
-                for (iterNeighbors = clusterNeighbors.begin(); iterNeighbors != clusterNeighbors.end(); iterNeighbors++ )
-                {
-                    if (static_cast<ClusterID>(mPointBuffer.at(*iterNeighbors).clusterID) == ClusterID::UNCLASSIFIED || static_cast<ClusterID>(mPointBuffer.at(
-                            *iterNeighbors).clusterID) == ClusterID::NOISE )
-                    {
-                        if (static_cast<ClusterID>(mPointBuffer.at(*iterNeighbors).clusterID) == ClusterID::UNCLASSIFIED )
-                        {
-                            clusterSeeds.push_back(*iterNeighbors);
-                            n = clusterSeeds.size();
-                        }
-                        mPointBuffer.at(*iterNeighbors).clusterID = clusterID;
-                    }
-                }
-            }
-        }
+const ZGMidiOutput &ZGObjectTracker::getMidiOutput() const
+{
+    return mMidiOutput;
+}
 
-        return 1;
-    }
+const ZGMidiClock &ZGObjectTracker::getMidiClock() const
+{
+    return mMidiClock;
 }
 
-int ZGObjectTracker::_dbScan() {
-    int clusterID = 1;
-    vector<ZGPoint>::iterator iter;
-    for(iter = mPointBuffer.begin(); iter != mPointBuffer.end(); ++iter)
-    {
-        if ( iter->clusterID == static_cast<int>(ClusterID::UNCLASSIFIED))
-        {
-            if (_expandCluster(*iter, clusterID) != static_cast<int>(ClusterID::ERROR) )
-            {
-                clusterID += 1;
-            }
-        }
-    }
+ZGMidiMapping &ZGObjectTracker::getMidiMapping()
+{
+    return mMidiMapping;
+}
 
-    for (int i = 1; i < clusterID; i++) {
-        std::vector<ZGPoint> cluster;
-        for (const auto& point : mPointBuffer) {
-            if (point.clusterID == i) {
-                cluster.push_back(point);
-            }
-        }
-       mClusters.push_back(cluster);
-    }
+const ZGBackgroundModel &ZGObjectTracker::getBackgroundModel() const {
+    return mBackgroundModel;
+}
 
-    return 0;
+const int &ZGObjectTracker::getBackgroundRemovedPercent() const {
+    return mSegmenter.getBackgroundRemovedPercent();
 }
 
-void ZGObjectTracker::_euclideanScan()
-{
-    std::vector<bool> visited(mPointBuffer.size(), false);
-    for (int i = 0; i < static_cast<int>(mPointBuffer.size()); i++) {
-        if (visited[i]) {
-            continue;
-        }
-        std::vector<ZGPoint> cluster;
-        cluster.push_back(mPointBuffer[i]);
-        visited[i] = true;
-        for (int j = i + 1; j < static_cast<int>(mPointBuffer.size()); j++) {
-            if (visited[j]) {
-                continue;
-            }
-            auto distance = ZGConversionHelpers::getDistance(mPointBuffer[j], mPointBuffer[i]);
-            if (distance <= mMaxClusterDistance) {
-                cluster.push_back(mPointBuffer[j]);
-                visited[j] = true;
-            }
-        }
-        if (static_cast<int>(cluster.size()) >= mMinPointsPerCluster) {
-            mClusters.push_back(cluster);
-        }
-    }
+void ZGObjectTracker::setBackgroundRemoval(bool inEnabled) {
+    mBackgroundModel.setEnabled(inEnabled);
+}
+
+void ZGObjectTracker::calibrateBackground() {
+    mBackgroundModel.calibrate();
+    mBackgroundModel.setEnabled(true);
+}
+
+ZGRegionOfInterest &ZGObjectTracker::getRegion() {
+    return mRegion;
 }
 
 const float &ZGObjectTracker::getMaxDistance() const {
@@ -230,35 +157,134 @@ void ZGObjectTracker::setMaxDistance(float inCentimeters) {
     for (auto& object : mTrackedObjects) {
         object.updateDistance(mMaxDistance);
     }
+    // Grid cells are sized from the range, so old history no longer lines up
+    mOccupancyGrid.reset(mMaxDistance);
+    mRegion.setMaxDistance(mMaxDistance);
+    mSegmenter.setMaxDistance(mMaxDistance);
+}
+
+const ScanMode &ZGObjectTracker::getScanMode() const {
+    return mScanMode;
+}
+
+void ZGObjectTracker::setScanMode(ScanMode inMode) {
+    mScanMode = inMode;
+}
+
+const float &ZGObjectTracker::getVoxelSize() const {
+    return mVoxelSize;
+}
+
+void ZGObjectTracker::setVoxelSize(float inCentimeters) {
+    mVoxelSize = std::max(inCentimeters, 0.f);
 }
 
-const bool &ZGObjectTracker::getScanMode() const {
-    return USE_DBSCAN_METHOD;
+const int &ZGObjectTracker::getPointsKeptPercent() const {
+    return mSegmenter.getPointsKeptPercent();
 }
 
-void ZGObjectTracker::setScanMode(bool useDBSCAN) {
-    USE_DBSCAN_METHOD = useDBSCAN;
+const ZGComputeBudget &ZGObjectTracker::getComputeBudget() const {
+    return mComputeBudget;
+}
+
+uint32_t ZGObjectTracker::_getActiveSectors() const {
+    uint32_t sectors = 1u << (mRevolution % ZGSegmenter::SECTORS);
+    for (const auto& object : mTrackedObjects) {
+        auto angle = ZGConversionHelpers::cartesianToPolar(object.getX(), object.getY()).angle;
+        auto sector = std::min(static_cast<int>(angle * (ZGSegmenter::SECTORS / 360.f)), ZGSegmenter::SECTORS - 1);
+        // Neighbouring sectors too, someone at a sector edge may be seen in either
+        sectors |= 1u << sector;
+        sectors |= 1u << ((sector + 1) % ZGSegmenter::SECTORS);
+        sectors |= 1u << ((sector + ZGSegmenter::SECTORS - 1) % ZGSegmenter::SECTORS);
+    }
+    return sectors;
+}
+
+const int &ZGObjectTracker::getClusteringWorkPercent() const {
+    return mSegmenter.getClusteringWorkPercent();
 }
 
 const int &ZGObjectTracker::getRootNote() const {
-    return mRootNote;
+    return mScaleQuantizer.getRoot();
 }
 
 void ZGObjectTracker::setRootNote(int inNote) {
-    mRootNote = inNote;
-    for (auto& object : mTrackedObjects) {
-        object.updateRootNote(mRootNote);
-    }
+    mScaleQuantizer.configure(mScaleQuantizer.getScale(), inNote, mScaleQuantizer.getOctaves());
 }
 
 const int &ZGObjectTracker::getScaleType() const {
-    return mScaleType;
+    return mScaleQuantizer.getScale();
 }
 
 void ZGObjectTracker::setScaleType(int inScaleType) {
-    mScaleType = inScaleType;
+    mScaleQuantizer.configure(inScaleType, mScaleQuantizer.getRoot(), mScaleQuantizer.getOctaves());
+}
+
+const int &ZGObjectTracker::getOctaves() const {
+    return mScaleQuantizer.getOctaves();
+}
+
+void ZGObjectTracker::setOctaves(int inOctaves) {
+    mScaleQuantizer.configure(mScaleQuantizer.getScale(), mScaleQuantizer.getRoot(), inOctaves);
+}
+
+const int &ZGObjectTracker::getPitchBendRange() const {
+    return mPitchBendRange;
+}
+
+void ZGObjectTracker::setPitchBendRange(int inSemitones) {
+    mPitchBendRange = inSemitones;
+    _sendMpeConfiguration();
+    for (auto& object : mTrackedObjects) {
+        object.updatePitchBendRange(mPitchBendRange);
+    }
+}
+
+const MpeZone &ZGObjectTracker::getMpeZone() const {
+    return mVoiceAllocator.getZone();
+}
+
+void ZGObjectTracker::setMpeZone(MpeZone inZone) {
+    mMidiOutput.setSampleTime(0);
     for (auto& object : mTrackedObjects) {
-        object.updateScaleType(mScaleType);
+        object.flagForRemoval(true);
+        object.requestToRemove();
+    }
+    mTrackedObjects.clear();
+    mVoiceAllocator.configure(inZone);
+    _sendMpeConfiguration();
+}
+
+const VoiceStealPolicy &ZGObjectTracker::getStealPolicy() const {
+    return mVoiceAllocator.getStealPolicy();
+}
+
+void ZGObjectTracker::setStealPolicy(VoiceStealPolicy inPolicy) {
+    mVoiceAllocator.setStealPolicy(inPolicy);
+}
+
+const int &ZGObjectTracker::getQuantizeGrid() const {
+    return mMidiOutput.getQuantizeGrid();
+}
+
+void ZGObjectTracker::setQuantizeGrid(int inTicksPerStep) {
+    mMidiOutput.setQuantizeGrid(inTicksPerStep);
+}
+
+void ZGObjectTracker::_sendMpeConfiguration() {
+    // Sent from the menu, not caused by any sample
+    mMidiOutput.setSampleTime(0);
+    // The configuration message resets member bend ranges to 48 so it has to go first
+    if (mPitchBendRange != 0) {
+        mVoiceAllocator.sendConfiguration();
+    }
+    for (int i = 0; i < mVoiceAllocator.getMemberCount(); i++) {
+        auto channel = mVoiceAllocator.getMemberChannel(i);
+        if (mPitchBendRange != 0) {
+            mMidiOutput.sendPitchBendRange(mPitchBendRange, channel);
+        }
+        mMidiOutput.sendPitchBend(0, channel);
     }
+    mMidiOutput.flush();
 }
 
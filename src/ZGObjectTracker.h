@@ -11,6 +11,23 @@
 #include <vector>
 #include <cmath>
 #include "ZGObject.h"
+#include "ZGOccupancyGrid.h"
+#include "ZGBackgroundModel.h"
+#include "ZGRegionOfInterest.h"
+#include "ZGRangeImage.h"
+#include "ZGPointCloud.h"
+#include "ZGClusterSet.h"
+#include "ZGDensityTable.h"
+#include "ZGClusterer.h"
+#include "ZGSegmenter.h"
+#include "ZGPersonDetector.h"
+#include "ZGComputeBudget.h"
+#include "ZGVoxelFilter.h"
+#include "ZGMidiClock.h"
+#include "ZGMidiOutput.h"
+#include "ZGVoiceAllocator.h"
+#include "ZGScaleQuantizer.h"
+#include "ZGMidiMapping.h"
 #include <unordered_map>
 
 #pragma once
@@ -31,27 +48,105 @@ public:
 
     /**
      * @brief Called once per 360 degree scan to find objects in the point cloud buffer and send midi data
-     * @param inBuffer Polar point data from the lidar. This function will clear the buffer when processing is finished
+     * @param inImage One revolution of lidar samples. This function filters the image in place and clears it when
+     * processing is finished
      * */
-    void processBuffer(std::vector<ZGPolarData>& inBuffer);
+    void processBuffer(ZGRangeImage& inImage);
 
     /**
-     * @return A const reference to the clusters found by the object tracker. Intended for plotting on LCD.
+     * @return A const reference to the clusters found by the object tracker, valid until the next processBuffer().
+     * Intended for plotting on LCD.
      */
-    const std::vector<std::vector<ZGPoint>> &getClusters() const;
+    const ZGClusterSet &getClusters() const;
+
+    /**
+     * @brief Reads incoming USB MIDI into the clock and sends quantized notes as they become due. Called every loop so
+     * the USB receive buffer never fills up
+     */
+    void processMidiInput();
 
     /**
      * @return A const reference to the objects currently tracked. Intended for plotting on LCD.
      */
     const std::vector<ZGObject> &getObjects() const;
 
+    /**
+     * @return A const reference to the occupancy grid accumulated over past revolutions. Intended for the heatmap view
+     * and exporting.
+     */
+    const ZGOccupancyGrid &getOccupancyGrid() const;
+
+    /**
+     * @return A const reference to the MIDI output stage, for traffic statistics
+     */
+    const ZGMidiOutput &getMidiOutput() const;
+
+    /**
+     * @return A const reference to the incoming MIDI clock, for the tempo readout
+     */
+    const ZGMidiClock &getMidiClock() const;
+
+    /**
+     * @return The feature to MIDI routes shared by every tracked object, for editing and storing
+     */
+    ZGMidiMapping &getMidiMapping();
+
+    /**
+     * @return A const reference to the learned background, for showing calibration progress
+     */
+    const ZGBackgroundModel &getBackgroundModel() const;
+
+    /**
+     * @return Share of the points inside the region that were dropped as background last revolution
+     */
+    const int& getBackgroundRemovedPercent() const;
+
+    /**
+     * @brief Turns removal of points that belong to the learned background on or off
+     */
+    void setBackgroundRemoval(bool inEnabled);
+
+    /**
+     * @brief Learns the background again over the next few seconds and turns removal on. The area should be empty
+     * while it runs
+     */
+    void calibrateBackground();
+
+    /**
+     * @return The area points are tracked in, for editing and storing
+     */
+    ZGRegionOfInterest &getRegion();
+
     const float& getMaxDistance() const;
 
     void setMaxDistance(float inCentimeters);
 
-    const bool& getScanMode() const;
+    const ScanMode& getScanMode() const;
+
+    void setScanMode(ScanMode inMode);
+
+    const float& getVoxelSize() const;
+
+    /**
+     * @param inCentimeters Width of the cells points are merged into before clustering, 0 clusters every point
+     */
+    void setVoxelSize(float inCentimeters);
+
+    /**
+     * @return Points left after voxel downsampling last revolution, as a percentage of the points that went in
+     */
+    const int& getPointsKeptPercent() const;
+
+    /**
+     * @return The controller that sheds processing when revolutions take too long, for showing its level
+     */
+    const ZGComputeBudget& getComputeBudget() const;
 
-    void setScanMode(bool useDBSCAN);
+    /**
+     * @return Distance comparisons made by clustering last revolution, as a percentage of one comparison between every
+     * pair of points in either mode
+     */
+    const int& getClusteringWorkPercent() const;
 
     const int& getRootNote() const;
 
@@ -59,53 +154,96 @@ public:
 
     const int& getScaleType() const;
 
+    /**
+     * @param inScaleType Index into ZGScales::definitions
+     */
     void setScaleType(int inScaleType);
 
-private:
+    const int& getOctaves() const;
 
     /**
-     * @brief Segments buffer of polar data into clusters using euclidean distance
-     * @param inBuffer Buffer will be cleared at the end of the function
-     * @see processBuffer()
+     * @param inOctaves Number of octaves spread around the full circle
      */
-    void _segmentPointCloud(std::vector<ZGPolarData>& inBuffer);
+    void setOctaves(int inOctaves);
+
+    const int& getPitchBendRange() const;
 
     /**
-     * @brief Utility function to find the center point given a cluster of points
-     * @param inCluster A vector of points comprising a cluster
-     * @return ZGPoint representing the center of the cluster
+     * @brief Switches between standard MIDI (0) and MPE expression with the given bend range in semitones. The range is
+     * sent to every member channel with RPN 0 and their bends are centered
      */
-    static ZGPoint _findClusterAverage(const std::vector<ZGPoint>& inCluster);
+    void setPitchBendRange(int inSemitones);
+
+    const MpeZone& getMpeZone() const;
 
     /**
-     * @brief Called after point cloud has been segmented in order to update tracked objects and send midi data
-     * @see _segmentPointCloud()
-     * @see processBuffer()
+     * @brief Moves the voices to the other MPE zone. Sounding notes are turned off and objects get new channels when they
+     * are next found
      */
-    void _updateTrackedObjects();
+    void setMpeZone(MpeZone inZone);
 
-    float mMaxDistance = 150.f; //in cm
-    const float mMaxClusterDistance = 70.f;
-    const int mMinPointsPerCluster = 10;
-    const float mEpsilon = 30.f;
-    int mScaleType = 0;
-    int mRootNote = 0;
+    const VoiceStealPolicy& getStealPolicy() const;
 
-    bool USE_DBSCAN_METHOD = true;
+    /**
+     * @param inPolicy Decides which object loses its channel when more objects are tracked than there are member channels
+     */
+    void setStealPolicy(VoiceStealPolicy inPolicy);
 
+    const int& getQuantizeGrid() const;
 
-    std::vector<std::vector<ZGPoint>> mClusters {};
-    std::vector<ZGPoint> mPointBuffer {};
-    std::vector<ZGObject> mTrackedObjects {};
+    /**
+     * @param inTicksPerStep Grid spacing in MIDI clock ticks that notes are held to while clock is running, 0 is off
+     */
+    void setQuantizeGrid(int inTicksPerStep);
+
+private:
+
+    /**
+     * @return One bit per sector that holds or borders a tracked object, plus one sector that rotates each revolution
+     * so new arrivals are still found
+     */
+    uint32_t _getActiveSectors() const;
+
+    /**
+     * @brief Called after point cloud has been segmented in order to update tracked objects and send midi data. Clusters
+     * are combined into people first, so a pair of legs is tracked as one object
+     * @see ZGSegmenter::segment()
+     * @see processBuffer()
+     */
+    void _updateTrackedObjects();
 
-    void _euclideanScan();
+    /**
+     * @brief Decays the occupancy grid and adds the points of every cluster found this revolution
+     */
+    void _updateOccupancyGrid();
 
-    // DBSCAN Functions //
-    int _dbScan();
+    /**
+     * @brief In MPE mode sends the zone configuration followed by the bend range of every member channel, in standard
+     * mode only centers the member channels' bends
+     */
+    void _sendMpeConfiguration();
+
+    float mMaxDistance = 150.f; //in cm
+    int mPitchBendRange = 0;
+    uint16_t mRevolution = 0;
+    uint32_t mRevolutionTime = 0; // micros() when the last sample of the current revolution was read
 
-    std::vector<int> _calculateCluster(ZGPoint point);
+    ScanMode mScanMode = ScanMode::DBSCAN;
 
-    int _expandCluster(ZGPoint &inPoint, int clusterID);
+    float mVoxelSize = 0;
+    uint32_t mLastProcessStart = 0;
 
+    ZGPersonDetector mPersonDetector {};
+    ZGComputeBudget mComputeBudget {};
+    std::vector<ZGObject> mTrackedObjects {};
+    ZGOccupancyGrid mOccupancyGrid {};
+    ZGBackgroundModel mBackgroundModel {};
+    ZGRegionOfInterest mRegion {};
+    ZGSegmenter mSegmenter {&mRegion, &mBackgroundModel};
+    ZGMidiClock mMidiClock {};
+    ZGMidiOutput mMidiOutput {&mMidiClock};
+    ZGVoiceAllocator mVoiceAllocator {&mMidiOutput};
+    ZGScaleQuantizer mScaleQuantizer {};
+    ZGMidiMapping mMidiMapping {};
 
 };
@@ -0,0 +1,69 @@
+//
+// ZGOccupancyGrid.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGOccupancyGrid.h"
+
+ZGOccupancyGrid::ZGOccupancyGrid() = default;
+
+ZGOccupancyGrid::~ZGOccupancyGrid() = default;
+
+void ZGOccupancyGrid::reset(float inRangeCentimeters) {
+    for (auto& cell : mCells) {
+        cell = 0;
+    }
+    mMaxCell = 0;
+    mRange = inRangeCentimeters;
+    mCellsPerCentimeter = GRID_SIZE / (2.f * inRangeCentimeters);
+}
+
+void ZGOccupancyGrid::decay() {
+    // cell -= cell / 2^shift, cells below 2^shift stop decaying which keeps faint history visible
+    uint32_t max_cell = 0;
+    for (auto& cell : mCells) {
+        cell -= cell >> mDecayShift;
+        max_cell = std::max(max_cell, cell);
+    }
+    mMaxCell = max_cell;
+}
+
+void ZGOccupancyGrid::addPoint(const ZGPoint& inPoint) {
+    auto column = static_cast<int>((inPoint.x + mRange) * mCellsPerCentimeter);
+    auto row = static_cast<int>((inPoint.y + mRange) * mCellsPerCentimeter);
+    if (column < 0 || column >= GRID_SIZE || row < 0 || row >= GRID_SIZE) {
+        return;
+    }
+
+    auto& cell = mCells[row * GRID_SIZE + column];
+    if (cell < MAX_CELL) {
+        cell += HIT_WEIGHT;
+    }
+    mMaxCell = std::max(mMaxCell, cell);
+}
+
+uint8_t ZGOccupancyGrid::getIntensity(int inColumn, int inRow) const {
+    if (mMaxCell == 0) {
+        return 0;
+    }
+    auto cell = static_cast<uint64_t>(mCells[inRow * GRID_SIZE + inColumn]);
+    return static_cast<uint8_t>(cell * 255 / mMaxCell);
+}
+
+void ZGOccupancyGrid::writeCSV(Print& inOutput) const {
+    for (int row = 0; row < GRID_SIZE; row++) {
+        for (int column = 0; column < GRID_SIZE; column++) {
+            inOutput.print(mCells[row * GRID_SIZE + column]);
+            inOutput.print(column == GRID_SIZE - 1 ? "\n" : ",");
+        }
+    }
+    inOutput.print("range_cm,");
+    inOutput.println(static_cast<int>(mRange));
+}
+
+void ZGOccupancyGrid::setDecayShift(int inShift) {
+    mDecayShift = std::max(1, std::min(inShift, 24));
+}
@@ -0,0 +1,73 @@
+//
+// ZGOccupancyGrid.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include "ZGConversionHelpers.h"
+
+#pragma once
+
+/**
+ * @brief Fixed size grid counting how often each area around the sensor is occupied. Every update decays all cells
+ * exponentially and adds the latest clustered points, so the grid shows where people have spent time over the last
+ * several minutes. Cell updates only use integer math.
+ */
+class ZGOccupancyGrid {
+public:
+    static constexpr int GRID_SIZE = 48;
+
+    /* */
+    ZGOccupancyGrid();
+
+    /* */
+    ~ZGOccupancyGrid();
+
+    /**
+     * @brief Clears the grid and sets the area it covers
+     * @param inRangeCentimeters Distance from the sensor to the edge of the grid
+     */
+    void reset(float inRangeCentimeters);
+
+    /**
+     * @brief Decays every cell once. Call once per revolution before adding that revolution's points
+     */
+    void decay();
+
+    /**
+     * @brief Adds one hit to the cell under the point. Points outside the grid are ignored
+     */
+    void addPoint(const ZGPoint& inPoint);
+
+    /**
+     * @return Cell value scaled to 0-255 relative to the current maximum cell, for colormapping
+     */
+    uint8_t getIntensity(int inColumn, int inRow) const;
+
+    /**
+     * @brief Writes the grid as CSV, one grid row per line, followed by the covered range
+     * @param inOutput Any Arduino Print such as Serial or an SD File
+     */
+    void writeCSV(Print& inOutput) const;
+
+    /**
+     * @param inShift Cells lose 1/2^shift of their value per revolution. 12 is a time constant of roughly 7 minutes
+     * at 10 revolutions per second
+     */
+    void setDecayShift(int inShift);
+
+private:
+
+    static constexpr uint32_t HIT_WEIGHT = 1 << 16;
+    static constexpr uint32_t MAX_CELL = 0xFFFFFFFF - HIT_WEIGHT;
+
+    uint32_t mCells[GRID_SIZE * GRID_SIZE] {};
+    uint32_t mMaxCell = 0;
+    int mDecayShift = 12;
+    float mRange = 150.f;
+    float mCellsPerCentimeter = GRID_SIZE / 300.f;
+
+};
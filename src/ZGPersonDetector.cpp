@@ -0,0 +1,164 @@
+//
+// ZGPersonDetector.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGPersonDetector.h"
+
+ZGPersonDetector::ZGPersonDetector() {
+    mPairs.reserve(MAX_LEGS * 4);
+    mPreviousPairs.reserve(MAX_LEGS);
+    mCurrentPairs.reserve(MAX_LEGS);
+}
+
+ZGPersonDetector::~ZGPersonDetector() = default;
+
+void ZGPersonDetector::detect(const ZGClusterSet &inClusters) {
+    mDetections.clear();
+    mPairs.clear();
+    mPaired.assign(inClusters.size(), false);
+    mCurrentPairs.clear();
+    mPreviousKept.assign(mPreviousPairs.size(), false);
+
+    auto leg_count = 0;
+    for (int i = 0; i < inClusters.size() && leg_count < MAX_LEGS; i++) {
+        const auto& stats = inClusters[i].getStats();
+        if (_getWidth(stats) <= MAX_LEG_WIDTH) {
+            mPreviousLegs[leg_count] = _findPreviousLeg(stats);
+            mLegs[leg_count++] = static_cast<uint8_t>(i);
+        }
+    }
+
+    // Every pair of legs close enough to belong to one person, the closest are paired first
+    for (int a = 0; a < leg_count; a++) {
+        const auto& first = inClusters[mLegs[a]].getStats();
+        for (int b = a + 1; b < leg_count; b++) {
+            const auto& second = inClusters[mLegs[b]].getStats();
+            auto dx = first.centerX - second.centerX;
+            auto dy = first.centerY - second.centerY;
+            auto distance_squared = dx * dx + dy * dy;
+            if (distance_squared <= MAX_LEG_SEPARATION * MAX_LEG_SEPARATION) {
+                auto previous_a = mPreviousLegs[a];
+                auto previous_b = mPreviousLegs[b];
+                auto previous = previous_a >= 0 && previous_a / 2 == previous_b / 2 ? previous_a / 2 : -1;
+                mPairs.push_back({distance_squared, previous, mLegs[a], mLegs[b]});
+            }
+        }
+    }
+    // Pairs kept from the last revolution first
+    std::sort(mPairs.begin(), mPairs.end(), [](const LegPair& inA, const LegPair& inB) {
+        if ((inA.previous >= 0) != (inB.previous >= 0)) {
+            return inA.previous >= 0;
+        }
+        return inA.distanceSquared < inB.distanceSquared;
+    });
+
+    for (const auto& pair : mPairs) {
+        if (mPaired[pair.first] || mPaired[pair.second]) {
+            continue;
+        }
+        mPaired[pair.first] = true;
+        mPaired[pair.second] = true;
+        if (pair.previous >= 0) {
+            mPreviousKept[pair.previous] = true;
+        }
+        const auto& first = inClusters[pair.first].getStats();
+        const auto& second = inClusters[pair.second].getStats();
+        PairedLegs legs {{first.centerX, second.centerX}, {first.centerY, second.centerY}, 0.f, 0.f, false, 0};
+        if (pair.previous >= 0) {
+            const auto& previous = mPreviousPairs[pair.previous];
+            legs.motionX = (legs.x[0] + legs.x[1] - previous.x[0] - previous.x[1]) * 0.5f;
+            legs.motionY = (legs.y[0] + legs.y[1] - previous.y[0] - previous.y[1]) * 0.5f;
+            legs.moving = true;
+        }
+        mCurrentPairs.push_back(legs);
+        ZGDetection detection;
+        detection.center = ZGPoint {(first.centerX + second.centerX) * 0.5f, (first.centerY + second.centerY) * 0.5f};
+        detection.center.time = std::max(first.latestTime, second.latestTime);
+        detection.count = first.count + second.count;
+        detection.firstCluster = pair.first;
+        detection.secondCluster = pair.second;
+        mDetections.push_back(detection);
+    }
+
+    // A leg left over from a pair whose other leg wasn't seen at all is centered between itself and the hidden leg
+    for (int a = 0; a < leg_count; a++) {
+        auto previous_leg = mPreviousLegs[a];
+        if (mPaired[mLegs[a]] || previous_leg < 0 || mPreviousKept[previous_leg / 2]) {
+            continue;
+        }
+        const auto& held = mPreviousPairs[previous_leg / 2];
+        auto other_seen = false;
+        for (int b = 0; b < leg_count; b++) {
+            other_seen = other_seen || (b != a && mPreviousLegs[b] >= 0 && mPreviousLegs[b] / 2 == previous_leg / 2);
+        }
+        if (other_seen || held.heldRevolutions >= MAX_HELD_REVOLUTIONS) {
+            continue;
+        }
+        mPaired[mLegs[a]] = true;
+        mPreviousKept[previous_leg / 2] = true;
+        const auto& stats = inClusters[mLegs[a]].getStats();
+        auto seen = previous_leg & 1;
+        auto held_x = held.x[seen ^ 1];
+        auto held_y = held.y[seen ^ 1];
+        if (held.moving) {
+            // The center moves by the average of both legs, so the hidden leg keeps the center's last motion
+            held_x += 2.f * held.motionX - (stats.centerX - held.x[seen]);
+            held_y += 2.f * held.motionY - (stats.centerY - held.y[seen]);
+        }
+        mCurrentPairs.push_back({{stats.centerX, held_x}, {stats.centerY, held_y}, held.motionX, held.motionY,
+                                 held.moving, held.heldRevolutions + 1});
+        ZGDetection detection;
+        detection.center = ZGPoint {(stats.centerX + held_x) * 0.5f, (stats.centerY + held_y) * 0.5f};
+        detection.center.time = stats.latestTime;
+        detection.count = stats.count;
+        detection.firstCluster = mLegs[a];
+        mDetections.push_back(detection);
+    }
+    std::swap(mPreviousPairs, mCurrentPairs);
+
+    for (int i = 0; i < inClusters.size(); i++) {
+        if (mPaired[i]) {
+            continue;
+        }
+        const auto& stats = inClusters[i].getStats();
+        ZGDetection detection;
+        detection.center = stats.getCenter();
+        detection.count = stats.count;
+        detection.firstCluster = i;
+        mDetections.push_back(detection);
+    }
+}
+
+const std::vector<ZGDetection> &ZGPersonDetector::getDetections() const {
+    return mDetections;
+}
+
+int ZGPersonDetector::_findPreviousLeg(const ZGClusterStats &inStats) const {
+    auto nearest = -1;
+    auto nearest_squared = MAX_LEG_STEP * MAX_LEG_STEP;
+    for (int pair = 0; pair < static_cast<int>(mPreviousPairs.size()); pair++) {
+        for (int side = 0; side < 2; side++) {
+            auto dx = inStats.centerX - mPreviousPairs[pair].x[side];
+            auto dy = inStats.centerY - mPreviousPairs[pair].y[side];
+            auto distance_squared = dx * dx + dy * dy;
+            if (distance_squared <= nearest_squared) {
+                nearest = pair * 2 + side;
+                nearest_squared = distance_squared;
+            }
+        }
+    }
+    return nearest;
+}
+
+float ZGPersonDetector::_getWidth(const ZGClusterStats &inStats) {
+    // Largest eigenvalue of the covariance is the variance along the long axis. Points spread evenly over a width w
+    // have a variance of w² / 12
+    auto mean = (inStats.varianceX + inStats.varianceY) * 0.5f;
+    auto difference = (inStats.varianceX - inStats.varianceY) * 0.5f;
+    auto major = mean + std::sqrt(difference * difference + inStats.covarianceXY * inStats.covarianceXY);
+    return std::sqrt(12.f * major);
+}
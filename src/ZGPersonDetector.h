@@ -0,0 +1,96 @@
+//
+// ZGPersonDetector.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <vector>
+#include "ZGClusterSet.h"
+
+#pragma once
+
+/**
+ * @brief One person or object found in a revolution
+ */
+struct ZGDetection {
+    ZGPoint center;     // Timed by the newest sample
+    int count = 0;      // Points of every cluster in the detection
+    int firstCluster = -1;
+    int secondCluster = -1; // -1 unless two legs were paired
+};
+
+/**
+ * @brief Combines clusters into people. With the sensor below the waist each leg is a separate small cluster, so
+ * leg sized clusters whose centers are a stride apart or less are paired, closest pairs first. A pair is centered
+ * between the two legs rather than on their points, so the center doesn't jump when one leg is partly hidden. Every
+ * other cluster is a detection of its own.
+ *
+ * The pairs of the last revolution are kept. Two legs that each moved less than a step from the same pair are paired
+ * again before any new pair is considered, so people walking close together keep their own legs. When one leg is
+ * fully hidden the visible one is still paired with the hidden leg for up to MAX_HELD_REVOLUTIONS, moved so the center
+ * keeps its last motion. Otherwise the detection would jump half a stride onto the visible leg and back.
+ */
+class ZGPersonDetector {
+public:
+    /* */
+    ZGPersonDetector();
+
+    /* */
+    ~ZGPersonDetector();
+
+    /**
+     * @brief Replaces the detections with the people found in the clusters
+     */
+    void detect(const ZGClusterSet& inClusters);
+
+    const std::vector<ZGDetection>& getDetections() const;
+
+private:
+
+    static constexpr float MAX_LEG_WIDTH = 25.f;        // cm across the long axis of the cluster
+    static constexpr float MAX_LEG_SEPARATION = 60.f;   // cm between leg centers, a wide stance
+    static constexpr int MAX_LEGS = 64;                 // More leg sized clusters than this are left unpaired
+    static constexpr float MAX_LEG_STEP = 35.f;         // cm a leg can move in one revolution and keep its pair
+    static constexpr int MAX_HELD_REVOLUTIONS = 1;      // Revolutions a hidden leg is held where it was last seen
+
+    /**
+     * @return Width of the cluster along its principal axis, from its covariance
+     */
+    static float _getWidth(const ZGClusterStats& inStats);
+
+    /**
+     * @brief Finds the leg of the last revolution's pairs nearest to a cluster
+     * @return Pair index * 2 + side, or -1 if no leg is within MAX_LEG_STEP
+     */
+    int _findPreviousLeg(const ZGClusterStats& inStats) const;
+
+    struct LegPair {
+        float distanceSquared;
+        int previous;       // Pair of the last revolution both legs continue, or -1
+        uint8_t first;
+        uint8_t second;
+    };
+
+    // Leg positions of one paired detection, kept for the next revolution
+    struct PairedLegs {
+        float x[2];
+        float y[2];
+        float motionX;          // cm the center moved since the last revolution
+        float motionY;
+        bool moving;            // The motion is known, the pair was kept from the last revolution
+        int heldRevolutions;    // Revolutions the second leg has been hidden
+    };
+
+    std::vector<ZGDetection> mDetections {};
+    std::vector<LegPair> mPairs {};
+    std::vector<bool> mPaired {};
+    std::vector<PairedLegs> mPreviousPairs {};
+    std::vector<PairedLegs> mCurrentPairs {};
+    std::vector<bool> mPreviousKept {};
+    uint8_t mLegs[MAX_LEGS] {};
+    int mPreviousLegs[MAX_LEGS] {};
+
+};
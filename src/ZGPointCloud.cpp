@@ -0,0 +1,77 @@
+//
+// ZGPointCloud.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGPointCloud.h"
+
+ZGPointCloud::ZGPointCloud() {
+    mX.reserve(MAX_POINTS);
+    mY.reserve(MAX_POINTS);
+    mPacked.reserve(MAX_POINTS);
+    mTimes.reserve(MAX_POINTS);
+    mLabels.reserve(MAX_POINTS);
+    mBands.reserve(MAX_POINTS);
+}
+
+ZGPointCloud::~ZGPointCloud() = default;
+
+void ZGPointCloud::clear() {
+    mX.clear();
+    mY.clear();
+    mPacked.clear();
+    mTimes.clear();
+    mLabels.clear();
+    mBands.clear();
+}
+
+void ZGPointCloud::addPoint(float inX, float inY, uint32_t inTime, uint8_t inBand) {
+    mX.push_back(inX);
+    mY.push_back(inY);
+    mPacked.push_back(ZGDistanceKernels::packMillimeters(inX, inY));
+    mTimes.push_back(inTime);
+    mLabels.push_back(static_cast<int>(ClusterID::UNCLASSIFIED));
+    mBands.push_back(inBand);
+}
+
+int ZGPointCloud::size() const {
+    return static_cast<int>(mX.size());
+}
+
+const float &ZGPointCloud::getX(int inIndex) const {
+    return mX[inIndex];
+}
+
+const float &ZGPointCloud::getY(int inIndex) const {
+    return mY[inIndex];
+}
+
+const uint32_t &ZGPointCloud::getTime(int inIndex) const {
+    return mTimes[inIndex];
+}
+
+const int &ZGPointCloud::getLabel(int inIndex) const {
+    return mLabels[inIndex];
+}
+
+const uint8_t &ZGPointCloud::getBand(int inIndex) const {
+    return mBands[inIndex];
+}
+
+const uint32_t &ZGPointCloud::getPacked(int inIndex) const {
+    return mPacked[inIndex];
+}
+
+void ZGPointCloud::setLabel(int inIndex, int inLabel) {
+    mLabels[inIndex] = inLabel;
+}
+
+ZGPoint ZGPointCloud::getPoint(int inIndex) const {
+    ZGPoint p {mX[inIndex], mY[inIndex]};
+    p.clusterID = mLabels[inIndex];
+    p.time = mTimes[inIndex];
+    return p;
+}
@@ -0,0 +1,82 @@
+//
+// ZGPointCloud.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <vector>
+#include "ZGConversionHelpers.h"
+#include "ZGDistanceKernels.h"
+#include "ZGRangeImage.h"
+
+#pragma once
+
+/**
+ * @brief The points of one revolution that are clustered, stored as separate arrays per field. ZGSpatialGrid copies
+ * the coordinates in cell order for its radius queries. Storage is reserved for one point per range image bin up
+ * front, so filling the cloud never allocates.
+ */
+class ZGPointCloud {
+public:
+    static constexpr int MAX_POINTS = ZGRangeImage::ANGLE_BINS;
+
+    /* */
+    ZGPointCloud();
+
+    /* */
+    ~ZGPointCloud();
+
+    /**
+     * @brief Removes every point, capacity is kept
+     */
+    void clear();
+
+    /**
+     * @brief Adds a point with an unclassified label
+     * @param inX cm
+     * @param inY cm
+     * @param inTime micros() when the sample was read
+     * @param inBand Range band the DBSCAN density parameters are looked up by
+     */
+    void addPoint(float inX, float inY, uint32_t inTime, uint8_t inBand);
+
+    int size() const;
+
+    const float& getX(int inIndex) const;
+
+    const float& getY(int inIndex) const;
+
+    const uint32_t& getTime(int inIndex) const;
+
+    const int& getLabel(int inIndex) const;
+
+    const uint8_t& getBand(int inIndex) const;
+
+    /**
+     * @return x and y in mm as int16 pairs, the layout ZGDistanceKernels::findNeighboursPacked() reads
+     */
+    const uint32_t& getPacked(int inIndex) const;
+
+    /**
+     * @param inLabel Cluster number counted from 1, or a ClusterID
+     */
+    void setLabel(int inIndex, int inLabel);
+
+    /**
+     * @return The point with its label in clusterID
+     */
+    ZGPoint getPoint(int inIndex) const;
+
+private:
+
+    std::vector<float> mX {};
+    std::vector<float> mY {};
+    std::vector<uint32_t> mPacked {};   // x and y in mm as int16 pairs, for the DSP kernel
+    std::vector<uint32_t> mTimes {};
+    std::vector<int> mLabels {};
+    std::vector<uint8_t> mBands {};
+
+};
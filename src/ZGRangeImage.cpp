@@ -0,0 +1,118 @@
+//
+// ZGRangeImage.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGRangeImage.h"
+
+constexpr int ZGRangeImage::ANGLE_BINS;
+
+ZGRangeImage::ZGRangeImage() = default;
+
+ZGRangeImage::~ZGRangeImage() = default;
+
+void ZGRangeImage::addSample(float inAngle, float inDistance, uint32_t inTime) {
+    auto bin = std::min(std::max(static_cast<int>(inAngle * (ANGLE_BINS / 360.f)), 0), ANGLE_BINS - 1);
+    auto distance = static_cast<uint16_t>(std::min(std::max(inDistance * 10.f, 1.f), 65535.f));
+    _store(bin, distance, inTime);
+}
+
+void ZGRangeImage::addRawSample(uint16_t inAngleQ14, uint32_t inDistanceQ2, uint32_t inTime) {
+    // A full turn is 1 << 16, so the bin is the angle scaled by ANGLE_BINS with the turn shifted out
+    auto bin = static_cast<int>((static_cast<uint32_t>(inAngleQ14) * ANGLE_BINS) >> 16);
+    auto distance = static_cast<uint16_t>(std::min<uint32_t>(std::max<uint32_t>(inDistanceQ2 >> 2, 1), 65535));
+    _store(bin, distance, inTime);
+}
+
+void ZGRangeImage::_store(int inBin, uint16_t inDistance, uint32_t inTime) {
+    auto& stored = mDistances[inBin];
+    if (stored == 0 || inDistance < stored) {
+        stored = inDistance;
+        mTimes[inBin] = inTime;
+    }
+    mSampleCount++;
+    mMeasurementCount++;
+    mLastSampleTime = inTime;
+}
+
+void ZGRangeImage::addMiss() {
+    mMeasurementCount++;
+}
+
+void ZGRangeImage::applyMedianFilter() {
+    // Nearest occupied neighbour on each side within the gap, found with one pass in each direction. The passes start
+    // MAX_NEIGHBOUR_GAP bins early so neighbours wrap around 0 degrees
+    uint16_t previous [ANGLE_BINS];
+    uint16_t next [ANGLE_BINS];
+
+    uint16_t last = 0;
+    auto age = MAX_NEIGHBOUR_GAP + 1;
+    for (int i = -MAX_NEIGHBOUR_GAP; i < ANGLE_BINS; i++) {
+        auto distance = mDistances[(i + ANGLE_BINS) % ANGLE_BINS];
+        if (i >= 0) {
+            previous[i] = age <= MAX_NEIGHBOUR_GAP ? last : 0;
+        }
+        age++;
+        if (distance != 0) {
+            last = distance;
+            age = 1;
+        }
+    }
+
+    last = 0;
+    age = MAX_NEIGHBOUR_GAP + 1;
+    for (int i = ANGLE_BINS - 1 + MAX_NEIGHBOUR_GAP; i >= 0; i--) {
+        auto distance = mDistances[i % ANGLE_BINS];
+        if (i < ANGLE_BINS) {
+            next[i] = age <= MAX_NEIGHBOUR_GAP ? last : 0;
+        }
+        age++;
+        if (distance != 0) {
+            last = distance;
+            age = 1;
+        }
+    }
+
+    // Branch free median of three so the compiler can vectorize it. A missing neighbour is 0, which pulls the median
+    // to 0 for isolated returns and to the nearer value at the edge of an object
+    for (int i = 0; i < ANGLE_BINS; i++) {
+        auto a = previous[i];
+        auto b = mDistances[i];
+        auto c = next[i];
+        auto median = std::max(std::min(a, b), std::min(std::max(a, b), c));
+        mDistances[i] = b == 0 ? 0 : median;
+    }
+}
+
+void ZGRangeImage::clear() {
+    memset(mDistances, 0, sizeof(mDistances));
+    mSampleCount = 0;
+    mMeasurementCount = 0;
+}
+
+float ZGRangeImage::getDistance(int inBin) const {
+    return static_cast<float>(mDistances[inBin]) * 0.1f;
+}
+
+const uint32_t &ZGRangeImage::getTime(int inBin) const {
+    return mTimes[inBin];
+}
+
+float ZGRangeImage::getAngle(int inBin) {
+    return (static_cast<float>(inBin) + 0.5f) * (360.f / ANGLE_BINS);
+}
+
+const int &ZGRangeImage::getSampleCount() const {
+    return mSampleCount;
+}
+
+const int &ZGRangeImage::getMeasurementCount() const {
+    return mMeasurementCount;
+}
+
+const uint32_t &ZGRangeImage::getLastSampleTime() const {
+    return mLastSampleTime;
+}
@@ -0,0 +1,104 @@
+//
+// ZGRangeImage.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <algorithm>
+
+#pragma once
+
+/**
+ * @brief One revolution of lidar samples in fixed angle bins, filled in place as samples arrive and cleared once the
+ * revolution is processed. When several samples land in one bin the nearest is kept. A three tap median along angle
+ * removes single beam speckle before the samples are clustered.
+ */
+class ZGRangeImage {
+public:
+    static constexpr int ANGLE_BINS = 720;
+
+    /* */
+    ZGRangeImage();
+
+    /* */
+    ~ZGRangeImage();
+
+    /**
+     * @param inAngle Degrees
+     * @param inDistance cm
+     * @param inTime micros() when the sample was read
+     */
+    void addSample(float inAngle, float inDistance, uint32_t inTime);
+
+    /**
+     * @brief Bins a sample straight from the lidar's fixed point fields with integer operations only
+     * @param inAngleQ14 Z angle with 90 degrees as 1 << 14, so a full turn is 1 << 16
+     * @param inDistanceQ2 mm with 2 fractional bits
+     * @param inTime micros() when the sample was read
+     */
+    void addRawSample(uint16_t inAngleQ14, uint32_t inDistanceQ2, uint32_t inTime);
+
+    /**
+     * @brief Counts a measurement that had no return, so the angular resolution is known in an empty room
+     */
+    void addMiss();
+
+    /**
+     * @brief Replaces every occupied bin with the median of itself and the nearest occupied bin on either side.
+     * Neighbours more than MAX_NEIGHBOUR_GAP bins away count as empty, so isolated returns are removed. Empty bins
+     * stay empty
+     */
+    void applyMedianFilter();
+
+    /**
+     * @brief Empties every bin for the next revolution
+     */
+    void clear();
+
+    /**
+     * @return Distance in cm, 0 if the bin is empty
+     */
+    float getDistance(int inBin) const;
+
+    /**
+     * @return micros() when the sample in the bin was read
+     */
+    const uint32_t& getTime(int inBin) const;
+
+    /**
+     * @return Angle of the bin center in degrees
+     */
+    static float getAngle(int inBin);
+
+    /**
+     * @return Samples added since the last clear, including ones that shared a bin
+     */
+    const int& getSampleCount() const;
+
+    /**
+     * @return Measurements since the last clear, with and without a return
+     */
+    const int& getMeasurementCount() const;
+
+    /**
+     * @return micros() when the latest sample was read
+     */
+    const uint32_t& getLastSampleTime() const;
+
+private:
+
+    // Two bins is one degree, wide enough for the sample spacing of the slower scan modes
+    static constexpr int MAX_NEIGHBOUR_GAP = 2;
+
+    void _store(int inBin, uint16_t inDistance, uint32_t inTime);
+
+    uint16_t mDistances[ANGLE_BINS] {};     // mm, 0 is empty
+    uint32_t mTimes[ANGLE_BINS] {};
+    int mSampleCount = 0;
+    int mMeasurementCount = 0;
+    uint32_t mLastSampleTime = 0;
+
+};
@@ -0,0 +1,185 @@
+//
+// ZGRegionOfInterest.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGRegionOfInterest.h"
+
+constexpr int ZGRegionPolygon::MAX_VERTICES;
+constexpr int ZGRegionOfInterest::MAX_POLYGONS;
+constexpr int ZGRegionOfInterest::MAX_INTERVALS;
+
+ZGRegionOfInterest::ZGRegionOfInterest() {
+    _rebuild();
+}
+
+ZGRegionOfInterest::~ZGRegionOfInterest() = default;
+
+bool ZGRegionOfInterest::contains(float inAngle, float inDistance) const {
+    auto bin = std::min(std::max(static_cast<int>(inAngle * (ANGLE_BINS / 360.f)), 0), ANGLE_BINS - 1);
+    auto distance = static_cast<uint32_t>(inDistance * 10.f);
+    for (const auto& interval : mIntervals[bin]) {
+        if (distance >= interval.min && distance <= interval.max) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ZGRegionOfInterest::setMaxDistance(float inCentimeters) {
+    mMaxDistance = inCentimeters;
+    _rebuild();
+}
+
+const bool &ZGRegionOfInterest::isEnabled() const {
+    return mEnabled;
+}
+
+void ZGRegionOfInterest::setEnabled(bool inEnabled) {
+    mEnabled = inEnabled;
+    _rebuild();
+}
+
+const ZGRegionPolygon &ZGRegionOfInterest::getPolygon(int inIndex) const {
+    return mPolygons[inIndex];
+}
+
+void ZGRegionOfInterest::setPolygon(int inIndex, const ZGRegionPolygon &inPolygon) {
+    mPolygons[inIndex] = inPolygon;
+    mPolygons[inIndex].count = std::min(std::max(inPolygon.count, 0), ZGRegionPolygon::MAX_VERTICES);
+    _rebuild();
+}
+
+void ZGRegionOfInterest::load(TeensyUserInterface &inUI) {
+    if (inUI.readConfigurationInt(EEPROM_ADDRESS, 0) != EEPROM_FORMAT) {
+        return;
+    }
+    mEnabled = inUI.readConfigurationInt(EEPROM_ADDRESS + 5, 0) != 0;
+
+    // Every int takes 5 bytes of EEPROM, vertices are stored as packed x/y pairs
+    auto address = EEPROM_ADDRESS + 10;
+    for (auto& polygon : mPolygons) {
+        polygon.count = std::min(std::max(inUI.readConfigurationInt(address, 0), 0), ZGRegionPolygon::MAX_VERTICES);
+        address += 5;
+        for (auto& vertex : polygon.vertices) {
+            auto packed = static_cast<uint32_t>(inUI.readConfigurationInt(address, 0));
+            vertex.x = static_cast<int16_t>(packed & 0xFFFF);
+            vertex.y = static_cast<int16_t>(packed >> 16);
+            address += 5;
+        }
+    }
+    _rebuild();
+}
+
+void ZGRegionOfInterest::save(TeensyUserInterface &inUI) const {
+    inUI.writeConfigurationInt(EEPROM_ADDRESS, EEPROM_FORMAT);
+    inUI.writeConfigurationInt(EEPROM_ADDRESS + 5, mEnabled);
+    auto address = EEPROM_ADDRESS + 10;
+    for (const auto& polygon : mPolygons) {
+        inUI.writeConfigurationInt(address, polygon.count);
+        address += 5;
+        for (const auto& vertex : polygon.vertices) {
+            auto packed = static_cast<uint16_t>(vertex.x) | static_cast<uint32_t>(static_cast<uint16_t>(vertex.y)) << 16;
+            inUI.writeConfigurationInt(address, static_cast<int>(packed));
+            address += 5;
+        }
+    }
+}
+
+void ZGRegionOfInterest::_rebuild() {
+    const int max_breakpoints = 2 + MAX_POLYGONS * ZGRegionPolygon::MAX_VERTICES;
+    for (int bin = 0; bin < ANGLE_BINS; bin++) {
+        auto angle = (static_cast<float>(bin) + 0.5f) * (360.f / ANGLE_BINS) * static_cast<float>(M_PI / 180.0);
+        auto dx = std::cos(angle);
+        auto dy = std::sin(angle);
+
+        // Every distance along the ray where it might enter or leave the region
+        float breakpoints [max_breakpoints];
+        auto count = 0;
+        breakpoints[count++] = 0;
+        breakpoints[count++] = mMaxDistance;
+        if (mEnabled) {
+            for (const auto& polygon : mPolygons) {
+                if (polygon.count < 3) {
+                    continue;
+                }
+                for (int i = 0; i < polygon.count; i++) {
+                    const auto& p = polygon.vertices[i];
+                    const auto& q = polygon.vertices[(i + 1) % polygon.count];
+                    auto ex = static_cast<float>(q.x - p.x);
+                    auto ey = static_cast<float>(q.y - p.y);
+                    auto denominator = dx * ey - dy * ex;
+                    if (std::abs(denominator) < 1e-6f) {
+                        continue;
+                    }
+                    auto t = (p.x * ey - p.y * ex) / denominator;
+                    auto s = (p.x * dy - p.y * dx) / denominator;
+                    if (s >= 0 && s <= 1 && t > 0 && t < mMaxDistance) {
+                        breakpoints[count++] = t;
+                    }
+                }
+            }
+        }
+        std::sort(breakpoints, breakpoints + count);
+
+        // Each span between breakpoints is entirely in or out, so its midpoint decides
+        auto intervals = mIntervals[bin];
+        auto interval_count = 0;
+        auto open = false;
+        for (int i = 0; i + 1 < count; i++) {
+            if (breakpoints[i + 1] <= breakpoints[i]) {
+                continue;
+            }
+            auto middle = (breakpoints[i] + breakpoints[i + 1]) * 0.5f;
+            auto inside = _isInside(dx * middle, dy * middle);
+            auto start = static_cast<uint16_t>(breakpoints[i] * 10.f);
+            auto end = static_cast<uint16_t>(breakpoints[i + 1] * 10.f);
+            if (inside && open) {
+                intervals[interval_count - 1].max = end;
+            } else if (inside && interval_count < MAX_INTERVALS) {
+                intervals[interval_count++] = Interval{start, end};
+                open = true;
+            } else if (inside) {
+                // Out of intervals, the last one grows to cover the rest rather than losing any of the region
+                intervals[interval_count - 1].max = end;
+                open = true;
+            } else {
+                open = false;
+            }
+        }
+        for (int i = interval_count; i < MAX_INTERVALS; i++) {
+            intervals[i] = Interval{1, 0};
+        }
+    }
+}
+
+bool ZGRegionOfInterest::_isInside(float inX, float inY) const {
+    if (!mEnabled) {
+        return true;
+    }
+    if (mPolygons[0].count >= 3 && !_isInsidePolygon(mPolygons[0], inX, inY)) {
+        return false;
+    }
+    for (int i = 1; i < MAX_POLYGONS; i++) {
+        if (mPolygons[i].count >= 3 && _isInsidePolygon(mPolygons[i], inX, inY)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ZGRegionOfInterest::_isInsidePolygon(const ZGRegionPolygon &inPolygon, float inX, float inY) {
+    auto inside = false;
+    for (int i = 0, j = inPolygon.count - 1; i < inPolygon.count; j = i++) {
+        const auto& a = inPolygon.vertices[i];
+        const auto& b = inPolygon.vertices[j];
+        if ((a.y > inY) != (b.y > inY) &&
+            inX < static_cast<float>(b.x - a.x) * (inY - a.y) / static_cast<float>(b.y - a.y) + a.x) {
+            inside = !inside;
+        }
+    }
+    return inside;
+}
@@ -0,0 +1,102 @@
+//
+// ZGRegionOfInterest.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <algorithm>
+#include <TeensyUserInterface.h>
+
+#pragma once
+
+struct ZGRegionVertex {
+    int16_t x; // cm
+    int16_t y; // cm
+};
+
+struct ZGRegionPolygon {
+    static constexpr int MAX_VERTICES = 8;
+
+    int count = 0; // Fewer than 3 vertices leaves the polygon unused
+    ZGRegionVertex vertices[MAX_VERTICES] {};
+};
+
+/**
+ * @brief Area that points are tracked in: the scan range, optionally cut down to an include polygon with up to two
+ * exclusion polygons taken out of it. Whenever the shape changes the ray through every angle bin is intersected with it
+ * once and stored as up to MAX_INTERVALS range intervals, so testing a point is a single table lookup.
+ */
+class ZGRegionOfInterest {
+public:
+    static constexpr int ANGLE_BINS = 720;
+    static constexpr int MAX_POLYGONS = 3; // The include polygon followed by the exclusion polygons
+    static constexpr int MAX_INTERVALS = 2;
+
+    /* */
+    ZGRegionOfInterest();
+
+    /* */
+    ~ZGRegionOfInterest();
+
+    /**
+     * @return True if the sample is inside the region
+     */
+    bool contains(float inAngle, float inDistance) const;
+
+    /**
+     * @param inCentimeters Scan range, the region never reaches beyond it
+     */
+    void setMaxDistance(float inCentimeters);
+
+    const bool& isEnabled() const;
+
+    /**
+     * @brief Applies the polygons, or only the scan range when disabled
+     */
+    void setEnabled(bool inEnabled);
+
+    /**
+     * @param inIndex 0 is the include polygon, the following ones are exclusions
+     */
+    const ZGRegionPolygon& getPolygon(int inIndex) const;
+
+    /**
+     * @brief Replaces a polygon and rebuilds the range table
+     */
+    void setPolygon(int inIndex, const ZGRegionPolygon& inPolygon);
+
+    /**
+     * @brief Reads the polygons from EEPROM, keeping the plain scan range if they were never saved
+     */
+    void load(TeensyUserInterface& inUI);
+
+    void save(TeensyUserInterface& inUI) const;
+
+private:
+
+    static constexpr int EEPROM_ADDRESS = 256;
+    static constexpr int EEPROM_FORMAT = 0x5A520001; // Bump when the stored layout changes
+
+    struct Interval {
+        uint16_t min; // mm
+        uint16_t max; // mm
+    };
+
+    /**
+     * @brief Intersects the ray through the center of every angle bin with the region
+     */
+    void _rebuild();
+
+    bool _isInside(float inX, float inY) const;
+
+    static bool _isInsidePolygon(const ZGRegionPolygon& inPolygon, float inX, float inY);
+
+    ZGRegionPolygon mPolygons[MAX_POLYGONS] {};
+    Interval mIntervals[ANGLE_BINS][MAX_INTERVALS] {};
+    float mMaxDistance = 150.f;
+    bool mEnabled = false;
+
+};
@@ -0,0 +1,61 @@
+//
+// ZGScaleQuantizer.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGScaleQuantizer.h"
+
+constexpr int ZGScaleQuantizer::MAX_OCTAVES;
+
+ZGScaleQuantizer::ZGScaleQuantizer() {
+    configure(mScale, mRoot, mOctaves);
+}
+
+ZGScaleQuantizer::~ZGScaleQuantizer() = default;
+
+void ZGScaleQuantizer::configure(int inScale, int inRoot, int inOctaves) {
+    mScale = std::min(std::max(inScale, 0), ZGScales::COUNT - 1);
+    mRoot = std::min(std::max(inRoot, 0), 11);
+    mOctaves = std::min(std::max(inOctaves, 1), MAX_OCTAVES);
+
+    const auto& steps = ZGScales::steps.scales[mScale];
+    mDegreeCount = steps.count * mOctaves;
+
+    for (int degree = 0; degree <= mDegreeCount; degree++) {
+        auto octave = degree / steps.count;
+        auto step = degree % steps.count;
+        mDegreeNotes[degree] = static_cast<uint8_t>(BASE_NOTE + mRoot + octave * 12 + steps.offsets[step]);
+    }
+
+    for (int bin = 0; bin < POSITION_BINS; bin++) {
+        mPositionNotes[bin] = mDegreeNotes[bin * mDegreeCount / POSITION_BINS];
+    }
+}
+
+int ZGScaleQuantizer::getNote(int32_t inPosition) const {
+    auto bin = std::min(std::max((inPosition * POSITION_BINS) >> 16, 0), POSITION_BINS - 1);
+    return mPositionNotes[bin];
+}
+
+int ZGScaleQuantizer::getDegreeNote(int inDegree) const {
+    return mDegreeNotes[std::min(std::max(inDegree, 0), mDegreeCount)];
+}
+
+const int &ZGScaleQuantizer::getDegreeCount() const {
+    return mDegreeCount;
+}
+
+const int &ZGScaleQuantizer::getScale() const {
+    return mScale;
+}
+
+const int &ZGScaleQuantizer::getRoot() const {
+    return mRoot;
+}
+
+const int &ZGScaleQuantizer::getOctaves() const {
+    return mOctaves;
+}
@@ -0,0 +1,148 @@
+//
+// ZGScaleQuantizer.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <algorithm>
+
+#pragma once
+
+struct ZGScale {
+    const char* name;
+    const char* shortName;
+    uint16_t intervals; // Bit n is set when the scale contains the note n semitones above the root
+};
+
+namespace ZGScales {
+
+    constexpr uint16_t intervalMask() {
+        return 0;
+    }
+
+    /**
+     * @brief Builds a ZGScale interval set from semitone offsets, eg. intervalMask(0, 2, 4, 7, 9)
+     */
+    template<typename... Semitones>
+    constexpr uint16_t intervalMask(int inFirst, Semitones... inRest) {
+        return static_cast<uint16_t>((1 << inFirst) | intervalMask(inRest...));
+    }
+
+    /**
+     * @brief Every scale selectable on the MIDI page. Add a line here to make a new interval set available
+     */
+    constexpr ZGScale definitions [] {
+            {"Chromatic",   "",     intervalMask(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11)},
+            {"Major",       "M",    intervalMask(0, 2, 4, 5, 7, 9, 11)},
+            {"Minor",       "m",    intervalMask(0, 2, 3, 5, 7, 8, 10)},
+            {"Dorian",      "Dor",  intervalMask(0, 2, 3, 5, 7, 9, 10)},
+            {"Phrygian",    "Phr",  intervalMask(0, 1, 3, 5, 7, 8, 10)},
+            {"Lydian",      "Lyd",  intervalMask(0, 2, 4, 6, 7, 9, 11)},
+            {"Mixolydian",  "Mix",  intervalMask(0, 2, 4, 5, 7, 9, 10)},
+            {"Locrian",     "Loc",  intervalMask(0, 1, 3, 5, 6, 8, 10)},
+            {"Harm Minor",  "hm",   intervalMask(0, 2, 3, 5, 7, 8, 11)},
+            {"Major Penta", "M5",   intervalMask(0, 2, 4, 7, 9)},
+            {"Minor Penta", "m5",   intervalMask(0, 3, 5, 7, 10)},
+            {"Blues",       "Blu",  intervalMask(0, 3, 5, 6, 7, 10)},
+            {"Whole Tone",  "WT",   intervalMask(0, 2, 4, 6, 8, 10)}
+    };
+
+    constexpr int COUNT = sizeof(definitions) / sizeof(definitions[0]);
+
+    struct Steps {
+        int count;
+        uint8_t offsets[12];
+    };
+
+    struct StepTable {
+        Steps scales[COUNT];
+    };
+
+    constexpr Steps makeSteps(uint16_t inIntervals) {
+        Steps steps {0, {}};
+        for (int semitone = 0; semitone < 12; semitone++) {
+            if ((inIntervals >> semitone) & 1) {
+                steps.offsets[steps.count++] = static_cast<uint8_t>(semitone);
+            }
+        }
+        return steps;
+    }
+
+    constexpr StepTable makeStepTable() {
+        StepTable table {};
+        for (int i = 0; i < COUNT; i++) {
+            table.scales[i] = makeSteps(definitions[i].intervals);
+        }
+        return table;
+    }
+
+    /**
+     * @brief Semitone offset of every scale degree within one octave, generated at compile time from definitions
+     */
+    constexpr StepTable steps = makeStepTable();
+
+}
+
+/**
+ * @brief Maps positions straight to MIDI notes through lookup tables that are rebuilt only when the scale, root or
+ * octave span changes. The position range is divided evenly between the degrees of every octave in the span, so each
+ * update is a single table read.
+ */
+class ZGScaleQuantizer {
+public:
+    static constexpr int POSITION_BINS = 720;
+    static constexpr int MAX_OCTAVES = 4;
+    static constexpr int BASE_NOTE = 48; // C3
+
+    /* */
+    ZGScaleQuantizer();
+
+    /* */
+    ~ZGScaleQuantizer();
+
+    /**
+     * @brief Rebuilds the lookup tables
+     * @param inScale Index into ZGScales::definitions
+     * @param inRoot Pitch class of the root, 0 is C
+     * @param inOctaves Number of octaves spread over the position range, 1 to MAX_OCTAVES
+     */
+    void configure(int inScale, int inRoot, int inOctaves);
+
+    /**
+     * @param inPosition Position within the span with 16 fractional bits, 0 to 65535
+     * @return MIDI note for the scale degree at this position
+     */
+    int getNote(int32_t inPosition) const;
+
+    /**
+     * @param inDegree Scale degree counted from the root at position 0. One past the last degree is the root an
+     * octave above the span
+     * @return MIDI note of the degree
+     */
+    int getDegreeNote(int inDegree) const;
+
+    /**
+     * @return Number of scale degrees in the span, a position times this count is the degree with 16 fractional bits
+     */
+    const int& getDegreeCount() const;
+
+    const int& getScale() const;
+
+    const int& getRoot() const;
+
+    const int& getOctaves() const;
+
+private:
+
+    int mScale = 0;
+    int mRoot = 0;
+    int mOctaves = 1;
+    int mDegreeCount = 12;
+
+    uint8_t mPositionNotes[POSITION_BINS] {};
+    uint8_t mDegreeNotes[12 * MAX_OCTAVES + 1] {};
+
+};
@@ -0,0 +1,108 @@
+//
+// ZGSegmenter.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGSegmenter.h"
+
+constexpr int ZGSegmenter::SECTORS;
+
+ZGSegmenter::ZGSegmenter(const ZGRegionOfInterest* inRegion, ZGBackgroundModel* inBackgroundModel) {
+    mRegion = inRegion;
+    mBackgroundModel = inBackgroundModel;
+}
+
+ZGSegmenter::~ZGSegmenter() = default;
+
+void ZGSegmenter::segment(ZGRangeImage& inImage, uint32_t inActiveSectors, float inVoxelSize, ScanMode inMode) {
+    mPointCloud.clear();
+    if (inVoxelSize != mVoxelFilter.getCellSize()) {
+        mVoxelFilter.setCellSize(inVoxelSize);
+    }
+    mVoxelFilter.clear();
+    // Merged points are never closer together than a cell, which the density parameters have to allow for
+    mDensity.update(inImage.getMeasurementCount(), inVoxelSize);
+    inImage.applyMedianFilter();
+    mBackgroundModel->update(inImage);
+
+    auto in_region = 0;
+    auto removed = 0;
+    auto kept = 0;
+    for (int bin = 0; bin < ZGRangeImage::ANGLE_BINS; bin++) {
+        if (((inActiveSectors >> (bin / SECTOR_BINS)) & 1) == 0) {
+            continue;
+        }
+        auto distance = inImage.getDistance(bin);
+        if (distance == 0) {
+            continue;
+        }
+        auto angle = ZGRangeImage::getAngle(bin);
+        if (!mRegion->contains(angle, distance)) {
+            continue;
+        }
+        in_region++;
+        // Walls and furniture never need to be clustered
+        if (mBackgroundModel->isBackground(angle, distance)) {
+            removed++;
+            continue;
+        }
+        mKeptX[kept] = angle;
+        mKeptDistances[kept] = distance;
+        mKeptTimes[kept] = inImage.getTime(bin);
+        kept++;
+    }
+    mBackgroundRemovedPercent = in_region == 0 ? 0 : removed * 100 / in_region;
+
+    // Convert polar to Cartesian coordinates, the angles are replaced by x
+    ZGFastTrig::polarToCartesian(mKeptX, mKeptDistances, kept, mKeptX, mKeptY);
+    for (int i = 0; i < kept; i++) {
+        if (mVoxelFilter.isEnabled()) {
+            mVoxelFilter.addPoint(mKeptX[i], mKeptY[i], mKeptTimes[i]);
+        } else {
+            mPointCloud.addPoint(mKeptX[i], mKeptY[i], mKeptTimes[i], ZGDensityTable::getBand(mKeptDistances[i]));
+        }
+    }
+    // One point per occupied cell at the centroid of the points that fell in it
+    for (int cell = 0; cell < mVoxelFilter.size(); cell++) {
+        auto x = mVoxelFilter.getX(cell);
+        auto y = mVoxelFilter.getY(cell);
+        mPointCloud.addPoint(x, y, mVoxelFilter.getTime(cell), ZGDensityTable::getBand(std::sqrt(x * x + y * y)));
+    }
+    mPointsKeptPercent = kept == 0 ? 100 : mPointCloud.size() * 100 / kept;
+
+    auto cluster_count = 0;
+    switch (inMode) {
+        case ScanMode::DISTANCE:
+            cluster_count = mClusterer.linkageScan(mPointCloud, mMaxDistance);
+            break;
+        case ScanMode::DBSCAN:
+            cluster_count = mClusterer.dbScan(mPointCloud, mDensity, mMaxDistance);
+            break;
+    }
+    auto pairs = static_cast<int64_t>(mPointCloud.size()) * mPointCloud.size();
+    mClusteringWorkPercent = pairs == 0 ? 0 : static_cast<int>(mClusterer.getDistanceChecks() * 100 / pairs);
+    mClusters.build(mPointCloud, cluster_count);
+}
+
+const ZGClusterSet &ZGSegmenter::getClusters() const {
+    return mClusters;
+}
+
+void ZGSegmenter::setMaxDistance(float inCentimeters) {
+    mMaxDistance = inCentimeters;
+}
+
+const int &ZGSegmenter::getBackgroundRemovedPercent() const {
+    return mBackgroundRemovedPercent;
+}
+
+const int &ZGSegmenter::getPointsKeptPercent() const {
+    return mPointsKeptPercent;
+}
+
+const int &ZGSegmenter::getClusteringWorkPercent() const {
+    return mClusteringWorkPercent;
+}
@@ -0,0 +1,100 @@
+//
+// ZGSegmenter.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <vector>
+#include "ZGRangeImage.h"
+#include "ZGRegionOfInterest.h"
+#include "ZGBackgroundModel.h"
+#include "ZGPointCloud.h"
+#include "ZGClusterSet.h"
+#include "ZGDensityTable.h"
+#include "ZGClusterer.h"
+#include "ZGVoxelFilter.h"
+#include "ZGFastTrig.h"
+
+#pragma once
+
+/**
+ * @brief Turns one revolution of the range image into clusters for the object tracker, kept apart from tracking and
+ * MIDI
+ */
+class ZGSegmenter {
+public:
+    // Sectors clustered at ComputeLevel::SECTORED, one bit each
+    static constexpr int SECTORS = 12;
+
+    /**
+     * @param inRegion Area points are tracked in
+     * @param inBackgroundModel Learned background, updated with every revolution that is segmented
+     */
+    ZGSegmenter(const ZGRegionOfInterest* inRegion, ZGBackgroundModel* inBackgroundModel);
+
+    /* */
+    ~ZGSegmenter();
+
+    /**
+     * @brief Denoises the range image, drops samples outside the region or in the background, optionally downsamples
+     * the rest and segments them into clusters
+     * @param inActiveSectors One bit per sector, samples in the others are skipped
+     * @param inVoxelSize Width of the cells points are merged into, 0 keeps every point
+     * @param inMode Clustering used this revolution, which the compute budget may have lowered
+     */
+    void segment(ZGRangeImage& inImage, uint32_t inActiveSectors, float inVoxelSize, ScanMode inMode);
+
+    /**
+     * @return Clusters found by the last segment(), valid until the next one
+     */
+    const ZGClusterSet& getClusters() const;
+
+    /**
+     * @param inCentimeters Scan range, for sizing the clustering grid
+     */
+    void setMaxDistance(float inCentimeters);
+
+    /**
+     * @return Share of the points inside the region that were dropped as background last revolution
+     */
+    const int& getBackgroundRemovedPercent() const;
+
+    /**
+     * @return Points left after voxel downsampling last revolution, as a percentage of the points that went in
+     */
+    const int& getPointsKeptPercent() const;
+
+    /**
+     * @return Distance comparisons made by clustering last revolution, as a percentage of one comparison between every
+     * pair of points in either mode
+     */
+    const int& getClusteringWorkPercent() const;
+
+private:
+
+    static constexpr int SECTOR_BINS = ZGRangeImage::ANGLE_BINS / SECTORS;
+
+    const ZGRegionOfInterest* mRegion;
+    ZGBackgroundModel* mBackgroundModel;
+    float mMaxDistance = 150.f;
+
+    int mBackgroundRemovedPercent = 0;
+    int mPointsKeptPercent = 100;
+    int mClusteringWorkPercent = 0;
+
+    // Samples that passed the gate and filter, converted to Cartesian coordinates in one batch
+    float mKeptX [ZGRangeImage::ANGLE_BINS] {};     // Holds the angles until they are converted
+    float mKeptY [ZGRangeImage::ANGLE_BINS] {};
+    float mKeptDistances [ZGRangeImage::ANGLE_BINS] {};
+    uint32_t mKeptTimes [ZGRangeImage::ANGLE_BINS] {};
+
+    ZGClusterSet mClusters {};
+    ZGPointCloud mPointCloud {};
+    ZGVoxelFilter mVoxelFilter {};
+    ZGClusterer mClusterer {};
+    ZGDensityTable mDensity {};
+
+};
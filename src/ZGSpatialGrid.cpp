@@ -0,0 +1,119 @@
+//
+// ZGSpatialGrid.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGSpatialGrid.h"
+
+constexpr int ZGSpatialGrid::MAX_COLUMNS;
+
+ZGSpatialGrid::ZGSpatialGrid() = default;
+
+ZGSpatialGrid::~ZGSpatialGrid() = default;
+
+void ZGSpatialGrid::build(const ZGPointCloud &inCloud, float inCellSize, float inRange) {
+    auto cell_size = std::max(inCellSize, 2.f * inRange / MAX_COLUMNS);
+    mColumns = std::min(std::max(static_cast<int>(std::ceil(2.f * inRange / cell_size)), 1), MAX_COLUMNS);
+    auto cells_per_centimeter = 1.f / cell_size;
+    auto cell_count = mColumns * mColumns;
+    mCandidateCount = 0;
+
+    std::fill(mCellStarts, mCellStarts + cell_count + 1, 0);
+    for (int i = 0; i < inCloud.size(); i++) {
+        auto column = static_cast<int>((inCloud.getX(i) + inRange) * cells_per_centimeter);
+        auto row = static_cast<int>((inCloud.getY(i) + inRange) * cells_per_centimeter);
+        column = std::min(std::max(column, 0), mColumns - 1);
+        row = std::min(std::max(row, 0), mColumns - 1);
+        mPointCells[i] = static_cast<uint16_t>(row * mColumns + column);
+        mCellStarts[mPointCells[i] + 1]++;
+    }
+
+    // Counts to start offsets, then place every point at its cell's next free slot
+    for (int cell = 0; cell < cell_count; cell++) {
+        mCellStarts[cell + 1] += mCellStarts[cell];
+    }
+    uint16_t next [MAX_COLUMNS * MAX_COLUMNS];
+    std::copy(mCellStarts, mCellStarts + cell_count, next);
+    for (int i = 0; i < inCloud.size(); i++) {
+        auto slot = next[mPointCells[i]]++;
+        mSortedPoints[slot] = static_cast<uint16_t>(i);
+#if defined(__ARM_FEATURE_DSP)
+        mSortedPacked[slot] = inCloud.getPacked(i);
+#else
+        mSortedX[slot] = inCloud.getX(i);
+        mSortedY[slot] = inCloud.getY(i);
+#endif
+    }
+}
+
+int ZGSpatialGrid::findNeighbours(const ZGPointCloud &inCloud, int inIndex, float inRadius, int *outIndices) const {
+    auto column = mPointCells[inIndex] % mColumns;
+    auto row = mPointCells[inIndex] / mColumns;
+    auto first_column = std::max(column - 1, 0);
+    auto last_column = std::min(column + 1, mColumns - 1);
+#if defined(__ARM_FEATURE_DSP)
+    auto query = inCloud.getPacked(inIndex);
+    auto radius_mm = inRadius * 10.f;
+    auto radius_squared = static_cast<int32_t>(radius_mm * radius_mm);
+#else
+    auto x = inCloud.getX(inIndex);
+    auto y = inCloud.getY(inIndex);
+    auto radius_squared = inRadius * inRadius;
+#endif
+    auto found = 0;
+    // The cells of one row are contiguous in the sorted points, so each row is one kernel call
+    for (int other_row = std::max(row - 1, 0); other_row <= std::min(row + 1, mColumns - 1); other_row++) {
+        auto begin = static_cast<int>(getCellBegin(first_column, other_row) - mSortedPoints);
+        auto count = static_cast<int>(getCellEnd(last_column, other_row) - mSortedPoints) - begin;
+        mCandidateCount += count;
+#if defined(__ARM_FEATURE_DSP)
+        auto row_found = ZGDistanceKernels::findNeighboursPacked(mSortedPacked + begin, count, query, radius_squared,
+                                                                 outIndices + found);
+#else
+        auto row_found = ZGDistanceKernels::findNeighboursSIMD(mSortedX + begin, mSortedY + begin, count, x, y,
+                                                               radius_squared, outIndices + found);
+#endif
+        // The kernel returns positions in the row, the caller wants points of the cloud
+        for (int i = found; i < found + row_found; i++) {
+            outIndices[i] = mSortedPoints[begin + outIndices[i]];
+        }
+        found += row_found;
+    }
+    return found;
+}
+
+int ZGSpatialGrid::countNearby(int inIndex) const {
+    auto column = mPointCells[inIndex] % mColumns;
+    auto row = mPointCells[inIndex] / mColumns;
+    auto first_column = std::max(column - 1, 0);
+    auto last_column = std::min(column + 1, mColumns - 1);
+    auto count = 0;
+    // The cells of one row are contiguous in the sorted points
+    for (int other_row = std::max(row - 1, 0); other_row <= std::min(row + 1, mColumns - 1); other_row++) {
+        count += static_cast<int>(getCellEnd(last_column, other_row) - getCellBegin(first_column, other_row));
+    }
+    return count;
+}
+
+const int &ZGSpatialGrid::getCandidateCount() const {
+    return mCandidateCount;
+}
+
+const int &ZGSpatialGrid::getColumns() const {
+    return mColumns;
+}
+
+int ZGSpatialGrid::getCell(int inPoint) const {
+    return mPointCells[inPoint];
+}
+
+const uint16_t *ZGSpatialGrid::getCellBegin(int inColumn, int inRow) const {
+    return mSortedPoints + mCellStarts[inRow * mColumns + inColumn];
+}
+
+const uint16_t *ZGSpatialGrid::getCellEnd(int inColumn, int inRow) const {
+    return mSortedPoints + mCellStarts[inRow * mColumns + inColumn + 1];
+}
@@ -0,0 +1,93 @@
+//
+// ZGSpatialGrid.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include "ZGPointCloud.h"
+
+#pragma once
+
+/**
+ * @brief Buckets the points of the cloud into square cells at least as wide as a search radius, so every point within
+ * the radius of another lies in the same or one of the eight surrounding cells. Points are counting sorted by cell
+ * into one index array, each cell is a range of it. Their coordinates are copied in the same order, so the cells of one
+ * row are a contiguous run the distance kernels stream through. Points beyond the covered range land in the edge cells.
+ */
+class ZGSpatialGrid {
+public:
+    // Cells per side, the cell size grows when the range would need more
+    static constexpr int MAX_COLUMNS = 64;
+
+    /* */
+    ZGSpatialGrid();
+
+    /* */
+    ~ZGSpatialGrid();
+
+    /**
+     * @brief Sorts every point of the cloud into its cell
+     * @param inCellSize Smallest cell width in cm, usually the search radius
+     * @param inRange Distance from the sensor to the edge of the grid in cm
+     */
+    void build(const ZGPointCloud& inCloud, float inCellSize, float inRange);
+
+    /**
+     * @brief Finds every point within inRadius of a point, the point itself included, by running the distance
+     * kernel over its cell and the eight around it
+     * @param inCloud The cloud the grid was built from
+     * @param inRadius cm, no larger than the cell size the grid was built with
+     * @param outIndices Receives the indices of the points found
+     * @return Number of points found
+     */
+    int findNeighbours(const ZGPointCloud& inCloud, int inIndex, float inRadius, int* outIndices) const;
+
+    /**
+     * @return Points in the cell of a point and the eight around it, which findNeighbours() would compare it with. No
+     * distances are computed
+     */
+    int countNearby(int inIndex) const;
+
+    /**
+     * @return Points compared by findNeighbours() since the grid was built
+     */
+    const int& getCandidateCount() const;
+
+    /**
+     * @return Cells per side of the grid as last built
+     */
+    const int& getColumns() const;
+
+    /**
+     * @return Cell the point was sorted into
+     */
+    int getCell(int inPoint) const;
+
+    /**
+     * @return Pointer to the first point index in the cell
+     */
+    const uint16_t* getCellBegin(int inColumn, int inRow) const;
+
+    /**
+     * @return Pointer past the last point index in the cell
+     */
+    const uint16_t* getCellEnd(int inColumn, int inRow) const;
+
+private:
+
+    int mColumns = 1;
+    mutable int mCandidateCount = 0;
+    uint16_t mCellStarts[MAX_COLUMNS * MAX_COLUMNS + 1] {};
+    uint16_t mPointCells[ZGPointCloud::MAX_POINTS] {};
+    uint16_t mSortedPoints[ZGPointCloud::MAX_POINTS] {};
+#if defined(__ARM_FEATURE_DSP)
+    uint32_t mSortedPacked[ZGPointCloud::MAX_POINTS] {};    // Coordinates in mm in sorted order, for the DSP kernel
+#else
+    float mSortedX[ZGPointCloud::MAX_POINTS] {};            // Coordinates in sorted order, for the SIMD kernel
+    float mSortedY[ZGPointCloud::MAX_POINTS] {};
+#endif
+
+};
@@ -0,0 +1,129 @@
+//
+// ZGVoiceAllocator.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGVoiceAllocator.h"
+
+constexpr int ZGVoiceAllocator::MAX_MEMBER_CHANNELS;
+
+ZGVoiceAllocator::ZGVoiceAllocator(ZGMidiOutput *inMidiOutput) {
+    mMidiOutput = inMidiOutput;
+    configure(mZone, mMemberCount);
+}
+
+ZGVoiceAllocator::~ZGVoiceAllocator() = default;
+
+void ZGVoiceAllocator::configure(MpeZone inZone, int inMemberChannels) {
+    mZone = inZone;
+    mMemberCount = std::min(std::max(inMemberChannels, 1), MAX_MEMBER_CHANNELS);
+
+    for (auto& voice : mVoices) {
+        voice = Voice{};
+    }
+    mFreeHead = 0;
+    mFreeCount = mMemberCount;
+    for (int i = 0; i < mMemberCount; i++) {
+        mFreeChannels[i] = getMemberChannel(i);
+    }
+}
+
+void ZGVoiceAllocator::sendConfiguration() {
+    auto other_manager = mZone == MpeZone::LOWER ? 16 : 1;
+    mMidiOutput->sendRegisteredParameter(6, 0, other_manager);
+    mMidiOutput->sendRegisteredParameter(6, mMemberCount, getManagerChannel());
+}
+
+int ZGVoiceAllocator::allocate(uint32_t &outVoiceId) {
+    int channel;
+    if (mFreeCount > 0) {
+        channel = mFreeChannels[mFreeHead];
+        mFreeHead = (mFreeHead + 1) % MAX_MEMBER_CHANNELS;
+        mFreeCount--;
+    } else {
+        channel = _steal();
+    }
+
+    outVoiceId = mNextVoiceId++;
+    mVoices[channel] = Voice{outVoiceId};
+    return channel;
+}
+
+void ZGVoiceAllocator::release(int inChannel, uint32_t inVoiceId) {
+    if (!isOwner(inChannel, inVoiceId)) {
+        return;
+    }
+    mVoices[inChannel].owner = 0;
+    mFreeChannels[(mFreeHead + mFreeCount) % MAX_MEMBER_CHANNELS] = inChannel;
+    mFreeCount++;
+}
+
+bool ZGVoiceAllocator::isOwner(int inChannel, uint32_t inVoiceId) const {
+    if (inChannel < 1 || inChannel > 16 || inVoiceId == 0) {
+        return false;
+    }
+    return mVoices[inChannel].owner == inVoiceId;
+}
+
+void ZGVoiceAllocator::updateVoice(int inChannel, uint32_t inVoiceId, int inNote, int inLevel, float inDistance) {
+    if (!isOwner(inChannel, inVoiceId)) {
+        return;
+    }
+    auto& voice = mVoices[inChannel];
+    voice.note = inNote;
+    voice.level = inLevel;
+    voice.distance = inDistance;
+}
+
+int ZGVoiceAllocator::_steal() {
+    auto victim = getMemberChannel(0);
+    for (int i = 1; i < mMemberCount; i++) {
+        auto channel = getMemberChannel(i);
+        const auto& candidate = mVoices[channel];
+        const auto& current = mVoices[victim];
+        auto is_better = false;
+        switch (mStealPolicy) {
+            case VoiceStealPolicy::OLDEST:
+                is_better = candidate.owner < current.owner;
+                break;
+            case VoiceStealPolicy::QUIETEST:
+                is_better = candidate.level < current.level;
+                break;
+            case VoiceStealPolicy::FARTHEST:
+                is_better = candidate.distance > current.distance;
+                break;
+        }
+        if (is_better) {
+            victim = channel;
+        }
+    }
+    mMidiOutput->sendNoteOff(mVoices[victim].note, 127, victim);
+    return victim;
+}
+
+void ZGVoiceAllocator::setStealPolicy(VoiceStealPolicy inPolicy) {
+    mStealPolicy = inPolicy;
+}
+
+const VoiceStealPolicy &ZGVoiceAllocator::getStealPolicy() const {
+    return mStealPolicy;
+}
+
+const MpeZone &ZGVoiceAllocator::getZone() const {
+    return mZone;
+}
+
+const int &ZGVoiceAllocator::getMemberCount() const {
+    return mMemberCount;
+}
+
+int ZGVoiceAllocator::getMemberChannel(int inIndex) const {
+    return mZone == MpeZone::LOWER ? 2 + inIndex : 15 - inIndex;
+}
+
+int ZGVoiceAllocator::getManagerChannel() const {
+    return mZone == MpeZone::LOWER ? 1 : 16;
+}
@@ -0,0 +1,126 @@
+//
+// ZGVoiceAllocator.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include <algorithm>
+#include "ZGMidiOutput.h"
+
+#pragma once
+
+enum class MpeZone {
+    LOWER,
+    UPPER
+};
+
+enum class VoiceStealPolicy {
+    OLDEST,
+    QUIETEST,
+    FARTHEST
+};
+
+/**
+ * @brief Hands out the member channels of an MPE zone to tracked objects, one channel per object. Released channels go to
+ * the back of a free list so a channel's release tail has the longest possible time to ring out before it is reused.
+ * When every channel is in use a voice is stolen according to the steal policy, the stolen object finds out through
+ * isOwner() and removes itself.
+ */
+class ZGVoiceAllocator {
+public:
+    static constexpr int MAX_MEMBER_CHANNELS = 15;
+
+    /**
+     * @param inMidiOutput Output stage used for the configuration message and for note offs of stolen voices
+     */
+    explicit ZGVoiceAllocator(ZGMidiOutput* inMidiOutput);
+
+    /* */
+    ~ZGVoiceAllocator();
+
+    /**
+     * @brief Sets the zone and clears every voice. The lower zone is managed on channel 1 with members counting up from
+     * channel 2, the upper zone is managed on channel 16 with members counting down from channel 15
+     * @param inMemberChannels 1-15
+     */
+    void configure(MpeZone inZone, int inMemberChannels = MAX_MEMBER_CHANNELS);
+
+    /**
+     * @brief Queues the MPE Configuration Message (RPN 6 on the manager channel). The other zone is closed first so a
+     * receiver never holds both
+     */
+    void sendConfiguration();
+
+    /**
+     * @brief Assigns the least recently released channel, or steals one if none are free
+     * @param outVoiceId Identifies this assignment, pass it back with the channel to the other functions
+     * @return Assigned channel
+     */
+    int allocate(uint32_t& outVoiceId);
+
+    /**
+     * @brief Frees the channel if the voice still owns it
+     */
+    void release(int inChannel, uint32_t inVoiceId);
+
+    /**
+     * @return False once the channel has been stolen or released
+     */
+    bool isOwner(int inChannel, uint32_t inVoiceId) const;
+
+    /**
+     * @brief Keeps the steal policy informed about a voice
+     * @param inNote Note currently sounding, turned off if the voice is stolen
+     * @param inLevel Expression level 0-127, the lowest level is the quietest voice
+     * @param inDistance Distance from the sensor in cm
+     */
+    void updateVoice(int inChannel, uint32_t inVoiceId, int inNote, int inLevel, float inDistance);
+
+    void setStealPolicy(VoiceStealPolicy inPolicy);
+
+    const VoiceStealPolicy& getStealPolicy() const;
+
+    const MpeZone& getZone() const;
+
+    const int& getMemberCount() const;
+
+    /**
+     * @param inIndex 0 to getMemberCount() - 1
+     * @return MIDI channel 1-16
+     */
+    int getMemberChannel(int inIndex) const;
+
+    int getManagerChannel() const;
+
+private:
+
+    struct Voice {
+        uint32_t owner = 0; // 0 while the channel is free
+        int note = 0;
+        int level = 0;
+        float distance = 0;
+    };
+
+    int _steal();
+
+    ZGMidiOutput* mMidiOutput;
+
+    MpeZone mZone = MpeZone::LOWER;
+    VoiceStealPolicy mStealPolicy = VoiceStealPolicy::OLDEST;
+    int mMemberCount = MAX_MEMBER_CHANNELS;
+
+    // Indexed by MIDI channel, entry 0 is unused
+    Voice mVoices[17] {};
+
+    // Ring buffer of free channels, oldest release first
+    int mFreeChannels[MAX_MEMBER_CHANNELS] {};
+    int mFreeHead = 0;
+    int mFreeCount = 0;
+
+    // Ids increase with every assignment so the smallest owner is the oldest voice
+    uint32_t mNextVoiceId = 1;
+
+};
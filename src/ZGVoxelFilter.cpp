@@ -0,0 +1,84 @@
+//
+// ZGVoxelFilter.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include "ZGVoxelFilter.h"
+
+constexpr uint16_t ZGVoxelFilter::EMPTY;
+
+ZGVoxelFilter::ZGVoxelFilter() {
+    clear();
+}
+
+ZGVoxelFilter::~ZGVoxelFilter() = default;
+
+void ZGVoxelFilter::setCellSize(float inCellSize) {
+    mCellSize = std::max(inCellSize, 0.f);
+    mInverseCellSize = mCellSize > 0 ? 1.f / mCellSize : 0;
+    clear();
+}
+
+const float &ZGVoxelFilter::getCellSize() const {
+    return mCellSize;
+}
+
+bool ZGVoxelFilter::isEnabled() const {
+    return mCellSize > 0;
+}
+
+void ZGVoxelFilter::clear() {
+    std::fill(mTable, mTable + TABLE_SIZE, EMPTY);
+    mCellCount = 0;
+    mInputCount = 0;
+}
+
+void ZGVoxelFilter::addPoint(float inX, float inY, uint32_t inTime) {
+    mInputCount++;
+    // Cell coordinates stay well inside 16 bits for any selectable range, so both fit one key
+    auto column = static_cast<int32_t>(std::floor(inX * mInverseCellSize));
+    auto row = static_cast<int32_t>(std::floor(inY * mInverseCellSize));
+    auto key = static_cast<uint16_t>(column) | static_cast<uint32_t>(static_cast<uint16_t>(row)) << 16;
+
+    auto slot = (key * 2654435761u) >> (32 - TABLE_BITS);
+    while (mTable[slot] != EMPTY) {
+        auto& cell = mCells[mTable[slot]];
+        if (cell.key == key) {
+            cell.sumX += inX;
+            cell.sumY += inY;
+            cell.time = std::max(cell.time, inTime);
+            cell.count++;
+            return;
+        }
+        slot = (slot + 1) & (TABLE_SIZE - 1);
+    }
+    // A revolution never has more points than there are cells, this only guards against misuse
+    if (mCellCount == MAX_CELLS) {
+        return;
+    }
+    mTable[slot] = static_cast<uint16_t>(mCellCount);
+    mCells[mCellCount++] = {key, inX, inY, inTime, 1};
+}
+
+const int &ZGVoxelFilter::size() const {
+    return mCellCount;
+}
+
+float ZGVoxelFilter::getX(int inCell) const {
+    return mCells[inCell].sumX / mCells[inCell].count;
+}
+
+float ZGVoxelFilter::getY(int inCell) const {
+    return mCells[inCell].sumY / mCells[inCell].count;
+}
+
+const uint32_t &ZGVoxelFilter::getTime(int inCell) const {
+    return mCells[inCell].time;
+}
+
+const int &ZGVoxelFilter::getInputCount() const {
+    return mInputCount;
+}
@@ -0,0 +1,87 @@
+//
+// ZGVoxelFilter.h
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+
+#include <Arduino.h>
+#include "ZGPointCloud.h"
+
+#pragma once
+
+/**
+ * @brief Thins the points of one revolution to one per square cell before clustering. Close to the sensor neighbouring
+ * samples are far closer together than anything being tracked needs, and every extra point costs region queries, so
+ * all points falling in the same cell are replaced by their centroid. Cells are found through an open addressing hash
+ * table of fixed size, nothing is allocated.
+ */
+class ZGVoxelFilter {
+public:
+    static constexpr int MAX_CELLS = ZGPointCloud::MAX_POINTS;
+
+    /* */
+    ZGVoxelFilter();
+
+    /* */
+    ~ZGVoxelFilter();
+
+    /**
+     * @param inCellSize Cell width in cm, 0 turns the filter off
+     */
+    void setCellSize(float inCellSize);
+
+    const float& getCellSize() const;
+
+    bool isEnabled() const;
+
+    /**
+     * @brief Empties every cell, called at the start of each revolution
+     */
+    void clear();
+
+    /**
+     * @brief Adds a point to the centroid of its cell
+     * @param inTime micros() when the point was measured, each cell keeps the latest
+     */
+    void addPoint(float inX, float inY, uint32_t inTime);
+
+    /**
+     * @return Number of occupied cells, in the order they were first filled
+     */
+    const int& size() const;
+
+    float getX(int inCell) const;
+
+    float getY(int inCell) const;
+
+    const uint32_t& getTime(int inCell) const;
+
+    /**
+     * @return Points added since the last clear()
+     */
+    const int& getInputCount() const;
+
+private:
+
+    static constexpr int TABLE_SIZE = 1024; // Power of two, never more than 70% full
+    static constexpr int TABLE_BITS = 10;
+    static constexpr uint16_t EMPTY = 0xFFFF;
+
+    struct Cell {
+        uint32_t key;
+        float sumX;
+        float sumY;
+        uint32_t time;
+        uint16_t count;
+    };
+
+    float mCellSize = 0;
+    float mInverseCellSize = 0;
+    uint16_t mTable[TABLE_SIZE] {}; // Index into mCells or EMPTY
+    Cell mCells[MAX_CELLS] {};
+    int mCellCount = 0;
+    int mInputCount = 0;
+
+};
@@ -0,0 +1,46 @@
+// Generated by   : tools/compress_images.py
+// Generated from : BackButtonDefault.c
+// Image Size     : 88x29 pixels
+// Memory usage   : 1138 bytes (5104 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short BackButtonDefaultRLE[569] ={
+0x8051, 0xFA80, 0x8007, 0x0000, 0x8051, 0xFA80, 0x8007, 0x0000, 0x8051, 0xFA80, 0x8007, 0x0000, 0x8052, 0xFA80, 0x8006, 0x0000,
+0x8052, 0xFA80, 0x8006, 0x0000, 0x8053, 0xFA80, 0x8005, 0x0000, 0x8053, 0xFA80, 0x8005, 0x0000, 0x800F, 0xFA80, 0x0001, 0xFB86,
+0x8006, 0xFBC8, 0x800A, 0xFA80, 0x0002, 0xFB86, 0xFBC8, 0x8009, 0xFA80, 0x0001, 0xFAE2, 0x8005, 0xFBC8, 0x0001, 0xFAE2, 0x8005,
+0xFA80, 0x0003, 0xFAE2, 0xFBC8, 0xFB86, 0x8004, 0xFA80, 0x0003, 0xFB86, 0xFBC8, 0xFB24, 0x8012, 0xFA80, 0x8005, 0x0000, 0x800F,
+0xFA80, 0x0001, 0xFE97, 0x8006, 0xFFDF, 0x0001, 0xFDD3, 0x8008, 0xFA80, 0x0004, 0xFB24, 0xFFDF, 0xFFDF, 0xFB86, 0x8007, 0xFA80,
+0x0002, 0xFAE2, 0xFED9, 0x8005, 0xFFDF, 0x0002, 0xFED9, 0xFAE2, 0x8004, 0xFA80, 0x0003, 0xFBC8, 0xFFDF, 0xFDD3, 0x8003, 0xFA80,
+0x0004, 0xFB24, 0xFF3B, 0xFF3B, 0xFB24, 0x8013, 0xFA80, 0x8004, 0x0000, 0x800F, 0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8004, 0xFC8C,
+0x0003, 0xFE35, 0xFFDF, 0xFD30, 0x8007, 0xFA80, 0x0004, 0xFC8C, 0xFFDF, 0xFFDF, 0xFD30, 0x8007, 0xFA80, 0x0003, 0xFED9, 0xFFDF,
+0xFDD4, 0x8003, 0xFC8C, 0x0003, 0xFE35, 0xFFDF, 0xFE97, 0x8004, 0xFA80, 0x0003, 0xFBC8, 0xFFDF, 0xFDD3, 0x8003, 0xFA80, 0x0003,
+0xFDD4, 0xFFDF, 0xFD30, 0x8014, 0xFA80, 0x8004, 0x0000, 0x800F, 0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8004, 0xFA80, 0x0003, 0xFBC8,
+0xFFDF, 0xFDD3, 0x8007, 0xFA80, 0x0004, 0xFF3B, 0xFF3B, 0xFE97, 0xFF9D, 0x8007, 0xFA80, 0x0002, 0xFFDF, 0xFF9D, 0x8005, 0xFA80,
+0x0002, 0xFFDF, 0xFF3B, 0x8004, 0xFA80, 0x0008, 0xFBC8, 0xFFDF, 0xFDD3, 0xFA80, 0xFA80, 0xFB24, 0xFFDF, 0xFF3B, 0x8015, 0xFA80,
+0x8004, 0x0000, 0x800F, 0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8004, 0xFA80, 0x0003, 0xFBC8, 0xFFDF, 0xFDD3, 0x8006, 0xFA80, 0x0006,
+0xFB86, 0xFFDF, 0xFD92, 0xFD30, 0xFFDF, 0xFBC8, 0x8006, 0xFA80, 0x0002, 0xFFDF, 0xFF3B, 0x800B, 0xFA80, 0x0008, 0xFBC8, 0xFFDF,
+0xFDD3, 0xFA80, 0xFA80, 0xFE97, 0xFFDF, 0xFC8B, 0x8016, 0xFA80, 0x8003, 0x0000, 0x800F, 0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8004,
+0xFC8C, 0x0003, 0xFED9, 0xFFDF, 0xFCCE, 0x8006, 0xFA80, 0x0006, 0xFDD4, 0xFFDF, 0xFB24, 0xFAE2, 0xFFDF, 0xFD92, 0x8006, 0xFA80,
+0x0002, 0xFFDF, 0xFF3B, 0x800B, 0xFA80, 0x0007, 0xFBC8, 0xFFDF, 0xFE97, 0xFC8C, 0xFD91, 0xFFDF, 0xFDD3, 0x8017, 0xFA80, 0x8003,
+0x0000, 0x800F, 0xFA80, 0x0001, 0xFE97, 0x8006, 0xFFDF, 0x0002, 0xFF9D, 0xFB86, 0x8006, 0xFA80, 0x0007, 0xFF3B, 0xFED9, 0xFA80,
+0xFA80, 0xFE97, 0xFF9D, 0xFAE2, 0x8005, 0xFA80, 0x0002, 0xFFDF, 0xFF3B, 0x800B, 0xFA80, 0x0001, 0xFBC8, 0x8005, 0xFFDF, 0x0001,
+0xFC29, 0x8018, 0xFA80, 0x0002, 0x0000, 0x0000, 0x800F, 0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8004, 0xFB24, 0x0004, 0xFB86, 0xFF9D,
+0xFF9D, 0xFAE2, 0x8004, 0xFA80, 0x0008, 0xFBC8, 0xFFDF, 0xFD91, 0xFBC8, 0xFBC8, 0xFDD3, 0xFFDF, 0xFBC8, 0x8005, 0xFA80, 0x0002,
+0xFFDF, 0xFF3B, 0x800B, 0xFA80, 0x0008, 0xFBC8, 0xFFDF, 0xFE98, 0xFBC8, 0xFC8C, 0xFFDF, 0xFF3B, 0xFAE2, 0x8017, 0xFA80, 0x0002,
+0x0000, 0x0000, 0x800F, 0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8005, 0xFA80, 0x0003, 0xFE97, 0xFFDF, 0xFB24, 0x8004, 0xFA80, 0x0001,
+0xFDD4, 0x8006, 0xFFDF, 0x0001, 0xFE97, 0x8005, 0xFA80, 0x0002, 0xFFDF, 0xFF3B, 0x8005, 0xFA80, 0x0002, 0xFBC8, 0xFBC8, 0x8004,
+0xFA80, 0x0008, 0xFBC8, 0xFFDF, 0xFDD3, 0xFA80, 0xFA80, 0xFD92, 0xFFDF, 0xFD30, 0x8017, 0xFA80, 0x0002, 0x0000, 0x0000, 0x800F,
+0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8005, 0xFA80, 0x0003, 0xFE97, 0xFFDF, 0xFB24, 0x8003, 0xFA80, 0x0003, 0xFAE2, 0xFFDF, 0xFF3B,
+0x8004, 0xFC8C, 0x0003, 0xFF3B, 0xFFDF, 0xFAE2, 0x8004, 0xFA80, 0x0003, 0xFFDF, 0xFF9D, 0xFB24, 0x8003, 0xFA80, 0x0003, 0xFB24,
+0xFFDF, 0xFF3B, 0x8004, 0xFA80, 0x0009, 0xFBC8, 0xFFDF, 0xFDD3, 0xFA80, 0xFA80, 0xFAE2, 0xFF3B, 0xFFDF, 0xFB86, 0x8017, 0xFA80,
+0x0001, 0x0000, 0x800F, 0xFA80, 0x0002, 0xFE97, 0xFFDF, 0x8004, 0xFDD3, 0x0004, 0xFE35, 0xFFDF, 0xFF3B, 0xFAE2, 0x8003, 0xFA80,
+0x0003, 0xFC8C, 0xFFDF, 0xFD92, 0x8004, 0xFA80, 0x0003, 0xFD30, 0xFFDF, 0xFCCE, 0x8004, 0xFA80, 0x0003, 0xFDD4, 0xFFDF, 0xFF3B,
+0x8003, 0xFDD3, 0x0003, 0xFF3B, 0xFFDF, 0xFD30, 0x8004, 0xFA80, 0x0003, 0xFBC8, 0xFFDF, 0xFDD3, 0x8003, 0xFA80, 0x0003, 0xFC2A,
+0xFFDF, 0xFE97, 0x8017, 0xFA80, 0x0001, 0x0000, 0x800F, 0xFA80, 0x0001, 0xFE97, 0x8006, 0xFFDF, 0x0002, 0xFF3B, 0xFB24, 0x8004,
+0xFA80, 0x0003, 0xFE97, 0xFFDF, 0xFB24, 0x8004, 0xFA80, 0x0003, 0xFAE2, 0xFFDF, 0xFE97, 0x8005, 0xFA80, 0x0001, 0xFDD4, 0x8005,
+0xFFDF, 0x0001, 0xFD30, 0x8005, 0xFA80, 0x0003, 0xFBC8, 0xFFDF, 0xFDD3, 0x8004, 0xFA80, 0x0003, 0xFE97, 0xFFDF, 0xFCCE, 0x8016,
+0xFA80, 0x0001, 0x0000, 0x8058, 0xFA80, 0x8058, 0xFA80, 0x8058, 0xFA80, 0x8058, 0xFA80, 0x8058, 0xFA80, 0x8058, 0xFA80, 0x8058,
+0xFA80, 0x8058, 0xFA80, 0x8058, 0xFA80, 0x8050, 0xFA80, 0x8008, 0x0000,
+};
@@ -0,0 +1,48 @@
+// Generated by   : tools/compress_images.py
+// Generated from : BackButtonPressed.c
+// Image Size     : 88x29 pixels
+// Memory usage   : 1190 bytes (5104 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short BackButtonPressedRLE[595] ={
+0x8050, 0x9576, 0x0001, 0x9556, 0x8007, 0x0000, 0x8050, 0x9576, 0x0001, 0x9556, 0x8007, 0x0000, 0x8051, 0x9576, 0x8007, 0x0000,
+0x8051, 0x9576, 0x0001, 0x9556, 0x8006, 0x0000, 0x8051, 0x9576, 0x0001, 0x9577, 0x8006, 0x0000, 0x8052, 0x9576, 0x0001, 0x8CF5,
+0x8005, 0x0000, 0x8052, 0x9576, 0x0001, 0x9556, 0x8005, 0x0000, 0x800F, 0x9576, 0x0001, 0xADD8, 0x8006, 0xADF9, 0x800A, 0x9576,
+0x0002, 0xADD8, 0xADF9, 0x8009, 0x9576, 0x0001, 0x9D97, 0x8005, 0xADF9, 0x0001, 0x9D97, 0x8005, 0x9576, 0x0003, 0x9D97, 0xADF9,
+0xADD8, 0x8004, 0x9576, 0x0003, 0xADD8, 0xADF9, 0xA5B8, 0x8012, 0x9576, 0x8005, 0x0000, 0x800F, 0x9576, 0x0001, 0xE73D, 0x8006,
+0xFFDF, 0x0001, 0xD6FC, 0x8008, 0x9576, 0x0004, 0xA5B8, 0xFFDF, 0xFFDF, 0xADD8, 0x8007, 0x9576, 0x0002, 0x9D97, 0xEF7E, 0x8005,
+0xFFDF, 0x0002, 0xEF7E, 0x9D97, 0x8004, 0x9576, 0x0003, 0xAE19, 0xFFDF, 0xD6FC, 0x8003, 0x9576, 0x0004, 0xA5B8, 0xEF9E, 0xEF9E,
+0xA5B8, 0x8012, 0x9576, 0x0001, 0x8CF5, 0x8004, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D, 0xFFDF, 0x8004, 0xBE5A, 0x0003, 0xDF1D,
+0xFFDF, 0xCE9B, 0x8007, 0x9576, 0x0004, 0xBE5A, 0xFFDF, 0xFFDF, 0xCE9B, 0x8007, 0x9576, 0x0003, 0xEF7E, 0xFFDF, 0xD6FC, 0x8003,
+0xBE5A, 0x0003, 0xDF1D, 0xFFDF, 0xE73D, 0x8004, 0x9576, 0x0003, 0xAE19, 0xFFDF, 0xD6FC, 0x8003, 0x9576, 0x0003, 0xD6FC, 0xFFDF,
+0xCE9B, 0x8013, 0x9576, 0x0001, 0x9556, 0x8004, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D, 0xFFDF, 0x8004, 0x9576, 0x0003, 0xAE19,
+0xFFDF, 0xD6FC, 0x8007, 0x9576, 0x0004, 0xEF9E, 0xEF9E, 0xE73D, 0xF7BF, 0x8007, 0x9576, 0x0002, 0xFFDF, 0xF7BF, 0x8005, 0x9576,
+0x0002, 0xFFDF, 0xEF9E, 0x8004, 0x9576, 0x0008, 0xAE19, 0xFFDF, 0xD6FC, 0x9576, 0x9576, 0xA5B8, 0xFFDF, 0xEF9E, 0x8015, 0x9576,
+0x8004, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D, 0xFFDF, 0x8004, 0x9576, 0x0003, 0xAE19, 0xFFDF, 0xD6FC, 0x8006, 0x9576, 0x0006,
+0xADD8, 0xFFDF, 0xCEDB, 0xCEBB, 0xFFDF, 0xADF9, 0x8006, 0x9576, 0x0002, 0xFFDF, 0xEF9E, 0x800B, 0x9576, 0x0008, 0xAE19, 0xFFDF,
+0xD6FC, 0x9576, 0x9576, 0xE73D, 0xFFDF, 0xBE5A, 0x8015, 0x9576, 0x0001, 0x9556, 0x8003, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D,
+0xFFDF, 0x8004, 0xBE5A, 0x0003, 0xEF7E, 0xFFDF, 0xC67A, 0x8006, 0x9576, 0x0006, 0xD6FC, 0xFFDF, 0xA5B8, 0x9D97, 0xFFDF, 0xCEDB,
+0x8006, 0x9576, 0x0002, 0xFFDF, 0xEF9E, 0x800B, 0x9576, 0x0007, 0xAE19, 0xFFDF, 0xE73D, 0xBE5A, 0xCEDB, 0xFFDF, 0xD6FC, 0x8017,
+0x9576, 0x8003, 0x0000, 0x800F, 0x9576, 0x0001, 0xE73D, 0x8006, 0xFFDF, 0x0002, 0xF7BF, 0xADD8, 0x8006, 0x9576, 0x0007, 0xEF9E,
+0xEF7E, 0x9576, 0x9576, 0xE73D, 0xF7BF, 0x9D97, 0x8005, 0x9576, 0x0002, 0xFFDF, 0xEF9E, 0x800B, 0x9576, 0x0001, 0xAE19, 0x8005,
+0xFFDF, 0x0001, 0xB639, 0x8017, 0x9576, 0x0003, 0x8CF5, 0x0000, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D, 0xFFDF, 0x8004, 0xA5B8,
+0x0004, 0xADD8, 0xF7BF, 0xF7BF, 0x9D97, 0x8004, 0x9576, 0x0008, 0xAE19, 0xFFDF, 0xCEDB, 0xADF9, 0xADF9, 0xD6FC, 0xFFDF, 0xADF9,
+0x8005, 0x9576, 0x0002, 0xFFDF, 0xEF9E, 0x800B, 0x9576, 0x0008, 0xAE19, 0xFFDF, 0xE73D, 0xAE19, 0xBE5A, 0xFFDF, 0xEF9E, 0x9D97,
+0x8016, 0x9576, 0x0003, 0x9556, 0x0000, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D, 0xFFDF, 0x8005, 0x9576, 0x0003, 0xE73D, 0xFFDF,
+0xA5B8, 0x8004, 0x9576, 0x0001, 0xD6FC, 0x8006, 0xFFDF, 0x0001, 0xE73D, 0x8005, 0x9576, 0x0002, 0xFFDF, 0xEF9E, 0x8005, 0x9576,
+0x0002, 0xADF9, 0xADF9, 0x8004, 0x9576, 0x0008, 0xAE19, 0xFFDF, 0xD6FC, 0x9576, 0x9576, 0xCEDB, 0xFFDF, 0xCE9B, 0x8017, 0x9576,
+0x0002, 0x0000, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D, 0xFFDF, 0x8005, 0x9576, 0x0003, 0xE73D, 0xFFDF, 0xA5B8, 0x8003, 0x9576,
+0x0003, 0x9D97, 0xFFDF, 0xEF9E, 0x8004, 0xBE5A, 0x0003, 0xEF9E, 0xFFDF, 0x9D97, 0x8004, 0x9576, 0x0003, 0xFFDF, 0xF7BF, 0xA5B8,
+0x8003, 0x9576, 0x0003, 0xA5B8, 0xFFDF, 0xEF9E, 0x8004, 0x9576, 0x0009, 0xAE19, 0xFFDF, 0xD6FC, 0x9576, 0x9576, 0x9D97, 0xEF9E,
+0xFFDF, 0xADD8, 0x8016, 0x9576, 0x0002, 0x8CF5, 0x0000, 0x800F, 0x9576, 0x0002, 0xE73D, 0xFFDF, 0x8004, 0xD6FC, 0x0004, 0xDF1D,
+0xFFDF, 0xEF9E, 0x9D97, 0x8003, 0x9576, 0x0003, 0xBE5A, 0xFFDF, 0xCEDB, 0x8004, 0x9576, 0x0003, 0xCEBB, 0xFFDF, 0xC67A, 0x8004,
+0x9576, 0x0003, 0xD6FC, 0xFFDF, 0xEF9E, 0x8003, 0xD6FC, 0x0003, 0xEF9E, 0xFFDF, 0xCE9B, 0x8004, 0x9576, 0x0003, 0xAE19, 0xFFDF,
+0xD6FC, 0x8003, 0x9576, 0x0003, 0xB639, 0xFFDF, 0xE73D, 0x8016, 0x9576, 0x0002, 0x9556, 0x0000, 0x800F, 0x9576, 0x0001, 0xE73D,
+0x8006, 0xFFDF, 0x0002, 0xEF9E, 0xA5B8, 0x8004, 0x9576, 0x0003, 0xE73D, 0xFFDF, 0xA5B8, 0x8004, 0x9576, 0x0003, 0x9D97, 0xFFDF,
+0xE73D, 0x8005, 0x9576, 0x0001, 0xD6FC, 0x8005, 0xFFDF, 0x0001, 0xCE9B, 0x8005, 0x9576, 0x0003, 0xAE19, 0xFFDF, 0xD6FC, 0x8004,
+0x9576, 0x0003, 0xE73D, 0xFFDF, 0xC67A, 0x8016, 0x9576, 0x0001, 0x0000, 0x8057, 0x9576, 0x0001, 0x9556, 0x8057, 0x9576, 0x0001,
+0x9556, 0x8058, 0x9576, 0x8058, 0x9576, 0x8058, 0x9576, 0x8058, 0x9576, 0x8058, 0x9576, 0x8058, 0x9576, 0x8058, 0x9576, 0x8050,
+0x9576, 0x8008, 0x0000,
+};
@@ -0,0 +1,314 @@
+// Generated by   : tools/compress_images.py
+// Generated from : LaunchScreen.c
+// Image Size     : 320x240 pixels
+// Memory usage   : 9704 bytes (153600 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short LaunchScreenRLE[4852] ={
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8051, 0x0000, 0x0001, 0x528A,
+0x803D, 0x9492, 0x0001, 0x9CF3, 0x800D, 0xA534, 0x0001, 0x94B2, 0x800B, 0x9492, 0x0001, 0x83EF, 0x8004, 0x7BEF, 0x0001, 0x7BCF,
+0x8004, 0x6B4D, 0x000E, 0x5AEB, 0x5AAA, 0x5AAA, 0x52AA, 0x4228, 0x4208, 0x4208, 0x3186, 0x3186, 0x2965, 0x2104, 0x2104, 0x1082,
+0x1082, 0x807F, 0x0000, 0x8051, 0x0000, 0x0001, 0xA514, 0x806D, 0xFFDF, 0x000A, 0xEF7D, 0xEF5D, 0xE6FB, 0xD69A, 0xC5F7, 0xA534,
+0x8C71, 0x738E, 0x4A49, 0x2104, 0x8077, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8077, 0xFFDF, 0x0004, 0xD69A, 0x9CF3, 0x6B6D,
+0x3186, 0x8073, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x807B, 0xFFDF, 0x0003, 0xCE59, 0x8C51, 0x39E7, 0x8070, 0x0000, 0x8051,
+0x0000, 0x0001, 0x8C51, 0x807E, 0xFFDF, 0x0003, 0xCE59, 0x6B6D, 0x18C3, 0x806D, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8080,
+0xFFDF, 0x0003, 0xF79E, 0x8C71, 0x2945, 0x806B, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8083, 0xFFDF, 0x0002, 0x9CB2, 0x2945,
+0x8069, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8085, 0xFFDF, 0x0002, 0x8410, 0x0020, 0x8067, 0x0000, 0x8051, 0x0000, 0x0001,
+0x8C51, 0x8086, 0xFFDF, 0x0002, 0xDEFB, 0x4A69, 0x8066, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8088, 0xFFDF, 0x0002, 0x9CF3,
+0x0841, 0x8064, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8089, 0xFFDF, 0x0002, 0xDEFB, 0x31A6, 0x8063, 0x0000, 0x8051, 0x0000,
+0x0001, 0x8C51, 0x808B, 0xFFDF, 0x0001, 0x632C, 0x8062, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x808C, 0xFFDF, 0x0001, 0x8C30,
+0x8061, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x808D, 0xFFDF, 0x0001, 0x9CF3, 0x8060, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51,
+0x808E, 0xFFDF, 0x0001, 0xAD75, 0x805F, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x808F, 0xFFDF, 0x0001, 0xA534, 0x805E, 0x0000,
+0x8051, 0x0000, 0x0001, 0x8C51, 0x8090, 0xFFDF, 0x0001, 0x9492, 0x805D, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8091, 0xFFDF,
+0x0001, 0x6B6D, 0x805C, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8092, 0xFFDF, 0x0001, 0x39E7, 0x805B, 0x0000, 0x8051, 0x0000,
+0x0001, 0x8C51, 0x8092, 0xFFDF, 0x0002, 0xF77D, 0x0861, 0x805A, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8093, 0xFFDF, 0x0001,
+0xB5B6, 0x805A, 0x0000, 0x8051, 0x0000, 0x0001, 0x8C51, 0x8066, 0xFFDF, 0x0007, 0xF7BE, 0xD6BA, 0xC618, 0xBDD7, 0xC618, 0xD69A,
+0xF79E, 0x8027, 0xFFDF, 0x0001, 0x5AEB, 0x8059, 0x0000, 0x8051, 0x0000, 0x0001, 0xA514, 0x8064, 0xFFDF, 0x0003, 0xB596, 0x5ACB,
+0x18C3, 0x8005, 0x0000, 0x0004, 0x10A2, 0x4A28, 0x9471, 0xDEBA, 0x8025, 0xFFDF, 0x0001, 0x0841, 0x8058, 0x0000, 0x8051, 0x0000,
+0x0001, 0x528A, 0x803E, 0x9492, 0x0002, 0x7BEF, 0xF77D, 0x8022, 0xFFDF, 0x0002, 0xB596, 0x3186, 0x800C, 0x0000, 0x0002, 0x4A28,
+0xB596, 0x8023, 0xFFDF, 0x0001, 0xA514, 0x8058, 0x0000, 0x8090, 0x0000, 0x0002, 0x5ACB, 0xF7BE, 0x8021, 0xFFDF, 0x0001, 0x630C,
+0x8010, 0x0000, 0x0002, 0x31A6, 0xB5B6, 0x8022, 0xFFDF, 0x0001, 0x2104, 0x8057, 0x0000, 0x808F, 0x0000, 0x0001, 0x5ACB, 0x8021,
+0xFFDF, 0x0002, 0xE71C, 0x2965, 0x8013, 0x0000, 0x0002, 0x5AEB, 0xFFBE, 0x8020, 0xFFDF, 0x0001, 0xB5B6, 0x8057, 0x0000, 0x808E,
+0x0000, 0x0001, 0x31A6, 0x8021, 0xFFDF, 0x0002, 0xE6FB, 0x10A2, 0x8015, 0x0000, 0x0002, 0x2124, 0xDEBA, 0x8020, 0xFFDF, 0x0001,
+0x2124, 0x8056, 0x0000, 0x808D, 0x0000, 0x0002, 0x10A2, 0xEF7D, 0x8020, 0xFFDF, 0x0002, 0xEF5D, 0x18C3, 0x8017, 0x0000, 0x0002,
+0x0861, 0xC618, 0x801F, 0xFFDF, 0x0001, 0xA534, 0x8056, 0x0000, 0x808D, 0x0000, 0x0001, 0xD69A, 0x8021, 0xFFDF, 0x0001, 0x2945,
+0x801A, 0x0000, 0x0001, 0xB5B6, 0x801F, 0xFFDF, 0x0001, 0x0861, 0x8055, 0x0000, 0x808C, 0x0000, 0x0001, 0xAD55, 0x8021, 0xFFDF,
+0x0001, 0x528A, 0x801C, 0x0000, 0x0001, 0xB596, 0x801E, 0xFFDF, 0x0001, 0x736D, 0x8055, 0x0000, 0x808B, 0x0000, 0x0001, 0x7BEF,
+0x8021, 0xFFDF, 0x0001, 0x8C71, 0x801E, 0x0000, 0x0001, 0xC618, 0x801D, 0xFFDF, 0x0001, 0xD69A, 0x8055, 0x0000, 0x808A, 0x0000,
+0x0001, 0x528A, 0x8021, 0xFFDF, 0x0001, 0xC5F7, 0x8020, 0x0000, 0x0001, 0xC638, 0x801D, 0xFFDF, 0x0001, 0x18E3, 0x8054, 0x0000,
+0x8089, 0x0000, 0x0001, 0x2965, 0x8021, 0xFFDF, 0x0002, 0xEF3C, 0x0841, 0x8020, 0x0000, 0x0002, 0x0020, 0xD69A, 0x801C, 0xFFDF,
+0x0001, 0x738E, 0x8054, 0x0000, 0x8088, 0x0000, 0x0002, 0x1082, 0xEF5D, 0x8021, 0xFFDF, 0x0001, 0x2965, 0x8022, 0x0000, 0x0002,
+0x0841, 0xD679, 0x801B, 0xFFDF, 0x0001, 0xC5F7, 0x8054, 0x0000, 0x8088, 0x0000, 0x0001, 0xCE59, 0x8021, 0xFFDF, 0x0001, 0x5AEB,
+0x8024, 0x0000, 0x0002, 0x0841, 0xCE79, 0x801A, 0xFFDF, 0x0002, 0xFFBE, 0x0861, 0x8053, 0x0000, 0x8087, 0x0000, 0x0001, 0xA4F3,
+0x8021, 0xFFDF, 0x0001, 0x9492, 0x8027, 0x0000, 0x0001, 0xBDD7, 0x801A, 0xFFDF, 0x0001, 0x39C7, 0x8053, 0x0000, 0x8086, 0x0000,
+0x0001, 0x73AE, 0x8021, 0xFFDF, 0x0001, 0xBDF7, 0x8029, 0x0000, 0x0001, 0xA534, 0x8019, 0xFFDF, 0x0001, 0x6B4D, 0x8053, 0x0000,
+0x8085, 0x0000, 0x0001, 0x4228, 0x8021, 0xFFDF, 0x0002, 0xEF5D, 0x0020, 0x802A, 0x0000, 0x0001, 0x9CB2, 0x8018, 0xFFDF, 0x0001,
+0x9CD3, 0x8053, 0x0000, 0x8084, 0x0000, 0x0002, 0x2104, 0xFFBE, 0x8021, 0xFFDF, 0x0001, 0x2965, 0x802C, 0x0000, 0x0001, 0x7BAE,
+0x8017, 0xFFDF, 0x0001, 0xC618, 0x8053, 0x0000, 0x8083, 0x0000, 0x0002, 0x0020, 0xE71C, 0x8021, 0xFFDF, 0x0001, 0x5ACB, 0x802E,
+0x0000, 0x0002, 0x41E7, 0xCE59, 0x8016, 0xFFDF, 0x0001, 0x0020, 0x8052, 0x0000, 0x8083, 0x0000, 0x0001, 0xBDD7, 0x8021, 0xFFDF,
+0x0001, 0x8C51, 0x8031, 0x0000, 0x0008, 0x39E7, 0x6B4D, 0x7BEF, 0x9492, 0x9CF3, 0xAD75, 0xAD75, 0xBDF7, 0x8006, 0xC5F7, 0x0001,
+0xB596, 0x8004, 0xAD75, 0x0004, 0x9CF3, 0x9CD3, 0x9CB2, 0x0861, 0x8052, 0x0000, 0x8082, 0x0000, 0x0001, 0x8C71, 0x8021, 0xFFDF,
+0x0001, 0xB5B6, 0x809B, 0x0000, 0x8081, 0x0000, 0x0001, 0x630C, 0x8021, 0xFFDF, 0x0001, 0xDEFB, 0x809C, 0x0000, 0x8080, 0x0000,
+0x0001, 0x31A6, 0x8022, 0xFFDF, 0x0001, 0x2104, 0x809C, 0x0000, 0x807F, 0x0000, 0x0002, 0x1082, 0xEF7D, 0x8021, 0xFFDF, 0x0001,
+0x4A49, 0x809D, 0x0000, 0x807F, 0x0000, 0x0001, 0xD69A, 0x8021, 0xFFDF, 0x0001, 0x73AE, 0x809E, 0x0000, 0x807E, 0x0000, 0x0001,
+0xAD55, 0x8021, 0xFFDF, 0x0001, 0xA514, 0x809F, 0x0000, 0x807D, 0x0000, 0x0001, 0x7BCF, 0x8021, 0xFFDF, 0x0001, 0xCE59, 0x80A0,
+0x0000, 0x807C, 0x0000, 0x0001, 0x4A69, 0x8021, 0xFFDF, 0x0002, 0xEF5D, 0x1082, 0x80A0, 0x0000, 0x807B, 0x0000, 0x0001, 0x2124,
+0x8022, 0xFFDF, 0x0001, 0x3186, 0x80A1, 0x0000, 0x807A, 0x0000, 0x0002, 0x0020, 0xE73C, 0x8021, 0xFFDF, 0x0001, 0x5ACB, 0x80A2,
+0x0000, 0x807A, 0x0000, 0x0001, 0xBDD7, 0x8021, 0xFFDF, 0x0001, 0x8430, 0x80A3, 0x0000, 0x8079, 0x0000, 0x0001, 0x9492, 0x8021,
+0xFFDF, 0x0001, 0xAD75, 0x80A4, 0x0000, 0x8078, 0x0000, 0x0001, 0x6B4D, 0x8021, 0xFFDF, 0x0001, 0xD69A, 0x80A5, 0x0000, 0x8077,
+0x0000, 0x0001, 0x39E7, 0x8021, 0xFFDF, 0x0002, 0xEF7D, 0x18A2, 0x80A5, 0x0000, 0x8076, 0x0000, 0x0002, 0x18C3, 0xF79E, 0x8021,
+0xFFDF, 0x0001, 0x3186, 0x80A6, 0x0000, 0x8076, 0x0000, 0x0001, 0xDEBA, 0x8021, 0xFFDF, 0x0001, 0x5ACB, 0x80A7, 0x0000, 0x8075,
+0x0000, 0x0001, 0xB596, 0x8021, 0xFFDF, 0x0001, 0x8430, 0x80A8, 0x0000, 0x8074, 0x0000, 0x0001, 0x8430, 0x8021, 0xFFDF, 0x0001,
+0xAD55, 0x8022, 0x0000, 0x0001, 0x4228, 0x8034, 0x6B4D, 0x0001, 0x0861, 0x8051, 0x0000, 0x8073, 0x0000, 0x0001, 0x630C, 0x8021,
+0xFFDF, 0x0001, 0xD679, 0x8023, 0x0000, 0x0001, 0xBDF7, 0x8034, 0xFFDF, 0x0001, 0x2124, 0x8051, 0x0000, 0x8072, 0x0000, 0x0001,
+0x31A6, 0x8021, 0xFFDF, 0x0002, 0xEF7D, 0x10A2, 0x8023, 0x0000, 0x0001, 0xA534, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000,
+0x8071, 0x0000, 0x0002, 0x10A2, 0xEF7D, 0x8021, 0xFFDF, 0x0001, 0x3186, 0x8024, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x8071, 0x0000, 0x0001, 0xD69A, 0x8021, 0xFFDF, 0x0001, 0x528A, 0x8025, 0x0000, 0x0001, 0xA514, 0x8034,
+0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8070, 0x0000, 0x0001, 0xAD55, 0x8021, 0xFFDF, 0x0001, 0x7BCF, 0x8026, 0x0000, 0x0001,
+0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x806F, 0x0000, 0x0001, 0x8410, 0x8021, 0xFFDF, 0x0001, 0xA514, 0x8027,
+0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x806E, 0x0000, 0x0001, 0x630C, 0x8021, 0xFFDF, 0x0001,
+0xC638, 0x8028, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x806D, 0x0000, 0x0001, 0x39C7, 0x8021,
+0xFFDF, 0x0002, 0xE73C, 0x0841, 0x8028, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x806C, 0x0000,
+0x0002, 0x18C3, 0xF79E, 0x8021, 0xFFDF, 0x0001, 0x2104, 0x8029, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051,
+0x0000, 0x806C, 0x0000, 0x0001, 0xDEBA, 0x8021, 0xFFDF, 0x0001, 0x4208, 0x802A, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x806B, 0x0000, 0x0001, 0xB5B6, 0x8021, 0xFFDF, 0x0001, 0x6B4D, 0x802B, 0x0000, 0x0001, 0xA514, 0x8034,
+0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x806A, 0x0000, 0x0001, 0x9492, 0x8021, 0xFFDF, 0x0001, 0x9471, 0x802C, 0x0000, 0x0001,
+0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8069, 0x0000, 0x0001, 0x6B6D, 0x8021, 0xFFDF, 0x0001, 0xB5B6, 0x802D,
+0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8068, 0x0000, 0x0001, 0x4A49, 0x8021, 0xFFDF, 0x0001,
+0xD6BA, 0x802E, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8067, 0x0000, 0x0001, 0x2965, 0x8021,
+0xFFDF, 0x0002, 0xEF5D, 0x10A2, 0x802E, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8066, 0x0000,
+0x0002, 0x1082, 0xEF5D, 0x8021, 0xFFDF, 0x0001, 0x3186, 0x802F, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051,
+0x0000, 0x8066, 0x0000, 0x0001, 0xD679, 0x8021, 0xFFDF, 0x0001, 0x52AA, 0x8030, 0x0000, 0x0001, 0xA514, 0x8034, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x8065, 0x0000, 0x0001, 0xB596, 0x8021, 0xFFDF, 0x0001, 0x73AE, 0x8031, 0x0000, 0x0001, 0xA514, 0x8034,
+0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8064, 0x0000, 0x0001, 0x9492, 0x8021, 0xFFDF, 0x0001, 0xA514, 0x8032, 0x0000, 0x0001,
+0xC5F7, 0x8034, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8063, 0x0000, 0x0001, 0x738E, 0x8021, 0xFFDF, 0x0001, 0xC618, 0x8033,
+0x0000, 0x0001, 0x6B4D, 0x801A, 0xA514, 0x0002, 0xA4F3, 0xF77D, 0x8018, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8062, 0x0000,
+0x0001, 0x52AA, 0x8021, 0xFFDF, 0x0002, 0xDEDB, 0x0841, 0x804F, 0x0000, 0x0001, 0xF77D, 0x8018, 0xFFDF, 0x0001, 0x2104, 0x8051,
+0x0000, 0x8061, 0x0000, 0x0001, 0x31A6, 0x8021, 0xFFDF, 0x0002, 0xFFBE, 0x18E3, 0x804F, 0x0000, 0x0001, 0x39E7, 0x8019, 0xFFDF,
+0x0001, 0x2104, 0x8051, 0x0000, 0x8060, 0x0000, 0x0002, 0x18E3, 0xF79E, 0x8021, 0xFFDF, 0x0001, 0x41E7, 0x8050, 0x0000, 0x0001,
+0x7BCF, 0x8019, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x805F, 0x0000, 0x0002, 0x0841, 0xE71C, 0x8021, 0xFFDF, 0x0001, 0x630C,
+0x8051, 0x0000, 0x0001, 0xC618, 0x8019, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x805F, 0x0000, 0x0001, 0xCE79, 0x8021, 0xFFDF,
+0x0001, 0x8C30, 0x8051, 0x0000, 0x0001, 0x0861, 0x801A, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x805E, 0x0000, 0x0001, 0xB5B6,
+0x8021, 0xFFDF, 0x0001, 0xAD75, 0x8052, 0x0000, 0x0001, 0x528A, 0x801A, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x805D, 0x0000,
+0x0001, 0x9CF3, 0x8021, 0xFFDF, 0x0001, 0xCE79, 0x8053, 0x0000, 0x0001, 0xB5B6, 0x801A, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000,
+0x805C, 0x0000, 0x0001, 0x8410, 0x8021, 0xFFDF, 0x0002, 0xEF3C, 0x0861, 0x8052, 0x0000, 0x0001, 0x0861, 0x801B, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x805B, 0x0000, 0x0001, 0x6B4D, 0x8022, 0xFFDF, 0x0001, 0x2945, 0x8053, 0x0000, 0x0001, 0x738E, 0x801B,
+0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x805A, 0x0000, 0x0001, 0x52AA, 0x8022, 0xFFDF, 0x0001, 0x4A69, 0x8054, 0x0000, 0x0001,
+0xEF3C, 0x801B, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8059, 0x0000, 0x0001, 0x4208, 0x8022, 0xFFDF, 0x0001, 0x738E, 0x8054,
+0x0000, 0x0001, 0x5AEB, 0x801C, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8058, 0x0000, 0x0001, 0x2965, 0x8022, 0xFFDF, 0x0001,
+0x9CD3, 0x8055, 0x0000, 0x0001, 0xEF5D, 0x801C, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8057, 0x0000, 0x0002, 0x18E3, 0xF77D,
+0x8021, 0xFFDF, 0x0001, 0xBDF7, 0x8055, 0x0000, 0x0001, 0x8410, 0x801D, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8056, 0x0000,
+0x0002, 0x0020, 0xDEFB, 0x8021, 0xFFDF, 0x0001, 0xDEFB, 0x8055, 0x0000, 0x0001, 0x3186, 0x801E, 0xFFDF, 0x0001, 0x2104, 0x8051,
+0x0000, 0x8056, 0x0000, 0x0001, 0xBDD7, 0x8021, 0xFFDF, 0x0002, 0xF7BE, 0x18C3, 0x8055, 0x0000, 0x0001, 0xE73C, 0x801E, 0xFFDF,
+0x0001, 0x2104, 0x8051, 0x0000, 0x8055, 0x0000, 0x0001, 0x8410, 0x8022, 0xFFDF, 0x0001, 0x39C7, 0x8055, 0x0000, 0x0001, 0xBDD7,
+0x801F, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8054, 0x0000, 0x0001, 0x39C7, 0x8022, 0xFFDF, 0x0001, 0x5AEB, 0x8055, 0x0000,
+0x0001, 0xAD55, 0x8020, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8054, 0x0000, 0x0001, 0xE73C, 0x8021, 0xFFDF, 0x0001, 0x8430,
+0x8054, 0x0000, 0x0002, 0x0841, 0xBDD7, 0x8021, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8053, 0x0000, 0x0001, 0x8C51, 0x8021,
+0xFFDF, 0x0001, 0xAD55, 0x8054, 0x0000, 0x0002, 0x39E7, 0xDEDB, 0x8022, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8052, 0x0000,
+0x0001, 0x18C3, 0x8021, 0xFFDF, 0x0001, 0xD69A, 0x8053, 0x0000, 0x0002, 0x10A2, 0x9471, 0x8024, 0xFFDF, 0x0001, 0x2104, 0x8051,
+0x0000, 0x8052, 0x0000, 0x0001, 0xAD55, 0x8020, 0xFFDF, 0x0002, 0xEF3C, 0x1082, 0x8051, 0x0000, 0x0003, 0x2104, 0x8430, 0xEF5D,
+0x8025, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8051, 0x0000, 0x0001, 0x18C3, 0x8021, 0xFFDF, 0x0001, 0x2945, 0x804F, 0x0000,
+0x0003, 0x2104, 0x632C, 0xAD75, 0x8028, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8051, 0x0000, 0x0001, 0x9492, 0x801F, 0xFFDF,
+0x0002, 0xEF5D, 0x2965, 0x8049, 0x0000, 0x0007, 0x0841, 0x18C3, 0x3186, 0x4A69, 0x6B4D, 0x9492, 0xCE59, 0x802B, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x8051, 0x0000, 0x0001, 0xF77D, 0x801F, 0xFFDF, 0x0002, 0xE71C, 0x8C51, 0x803D, 0xA514, 0x0001, 0xB596,
+0x8004, 0xBDB6, 0x0001, 0xBDD7, 0x8004, 0xCE59, 0x0004, 0xDEDB, 0xDEDB, 0xEF5D, 0xFFBE, 0x8030, 0xFFDF, 0x0001, 0x2104, 0x8051,
+0x0000, 0x8050, 0x0000, 0x0001, 0x4A49, 0x809D, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8050, 0x0000, 0x0001, 0xA534, 0x809D,
+0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x8050, 0x0000, 0x0001, 0xE73C, 0x809D, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804F,
+0x0000, 0x0001, 0x2124, 0x809E, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0x5AEB, 0x809E, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0x9492, 0x809E, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001,
+0xBDB6, 0x8088, 0xFFDF, 0x0002, 0x94B2, 0xE71C, 0x8014, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0xD679,
+0x8087, 0xFFDF, 0x0003, 0x9492, 0x0000, 0xCE38, 0x8014, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0xE6FB,
+0x8086, 0xFFDF, 0x0004, 0xB5B6, 0x0000, 0x0000, 0x9CB2, 0x8014, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804E, 0x0000, 0x0002,
+0x0841, 0xEF5D, 0x8085, 0xFFDF, 0x0001, 0xC5F7, 0x8003, 0x0000, 0x0001, 0x4228, 0x8014, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000,
+0x804E, 0x0000, 0x0002, 0x10A2, 0xF79E, 0x8084, 0xFFDF, 0x0001, 0xB596, 0x8005, 0x0000, 0x0001, 0xEF7D, 0x8013, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x804E, 0x0000, 0x0001, 0x18C3, 0x8084, 0xFFDF, 0x0001, 0xA534, 0x8006, 0x0000, 0x0001, 0xBDD7, 0x8013,
+0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804E, 0x0000, 0x0001, 0x18C3, 0x8083, 0xFFDF, 0x0001, 0x8410, 0x8007, 0x0000, 0x0001,
+0x738E, 0x8013, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804E, 0x0000, 0x0002, 0x10A2, 0xF79E, 0x8080, 0xFFDF, 0x0002, 0xF77D,
+0x52AA, 0x8008, 0x0000, 0x0001, 0x2104, 0x8013, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804E, 0x0000, 0x0002, 0x0861, 0xEF5D,
+0x807F, 0xFFDF, 0x0002, 0xB5B6, 0x18E3, 0x800A, 0x0000, 0x0001, 0xD679, 0x8012, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804E,
+0x0000, 0x0002, 0x0020, 0xE73C, 0x807D, 0xFFDF, 0x0002, 0xEF3C, 0x6B4D, 0x800C, 0x0000, 0x0001, 0x9471, 0x8012, 0xFFDF, 0x0001,
+0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0xDEBA, 0x807B, 0xFFDF, 0x0003, 0xF79E, 0x9471, 0x1082, 0x800D, 0x0000, 0x0001,
+0x4A69, 0x8012, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0xCE59, 0x8079, 0xFFDF, 0x0003, 0xF79E, 0x9492,
+0x18E3, 0x800F, 0x0000, 0x0002, 0x0841, 0xF79E, 0x8011, 0xFFDF, 0x0001, 0x2104, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0xB5B6,
+0x8077, 0xFFDF, 0x0003, 0xCE79, 0x736D, 0x18A2, 0x8012, 0x0000, 0x0001, 0xBDD7, 0x8011, 0xFFDF, 0x0001, 0x2124, 0x8051, 0x0000,
+0x804F, 0x0000, 0x0001, 0x9CD3, 0x8074, 0xFFDF, 0x0003, 0xCE79, 0x8410, 0x31A6, 0x8015, 0x0000, 0x0001, 0x2945, 0x8011, 0x5ACB,
+0x0001, 0x0861, 0x8051, 0x0000, 0x804F, 0x0000, 0x0001, 0x7BCF, 0x806F, 0xFFDF, 0x0005, 0xF79E, 0xCE59, 0x94B2, 0x5ACB, 0x2104,
+0x807C, 0x0000, 0x804F, 0x0000, 0x0001, 0x528A, 0x801A, 0xFFDF, 0x802D, 0xEF7D, 0x0001, 0xF77D, 0x801E, 0xFFDF, 0x000A, 0xFFBE,
+0xEF5D, 0xDEFB, 0xCE38, 0xB596, 0x94B2, 0x73AE, 0x5ACB, 0x39C7, 0x10A2, 0x8080, 0x0000, 0x804F, 0x0000, 0x0001, 0x0020, 0x8019,
+0x2104, 0x0001, 0x18E3, 0x802D, 0x1082, 0x0001, 0x10A2, 0x8009, 0x2104, 0x0001, 0x2124, 0x8006, 0x3186, 0x0001, 0x39C7, 0x8009,
+0x4208, 0x0006, 0x39E7, 0x3186, 0x3186, 0x2104, 0x18C3, 0x0861, 0x8088, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8013, 0x0000, 0x0001, 0x1082, 0x801C, 0x31A6, 0x0001, 0x1082, 0x800F, 0x0000, 0x0004, 0x3186, 0x31A6, 0x31A6,
+0x0020, 0x800F, 0x0000, 0x0001, 0x0861, 0x8003, 0x31A6, 0x0001, 0x18E3, 0x8014, 0x0000, 0x0004, 0x2104, 0x31A6, 0x31A6, 0x3186,
+0x8004, 0x0000, 0x0001, 0x10A2, 0x8015, 0x31A6, 0x0001, 0x18E3, 0x8018, 0x0000, 0x0002, 0x10A2, 0x2945, 0x8011, 0x31A6, 0x0001,
+0x18E3, 0x8008, 0x0000, 0x0002, 0x0841, 0x2124, 0x800F, 0x31A6, 0x0002, 0x2965, 0x18E3, 0x8008, 0x0000, 0x0001, 0x0020, 0x8004,
+0x31A6, 0x0001, 0x0841, 0x8020, 0x0000, 0x8003, 0x31A6, 0x8013, 0x0000, 0x0002, 0x10A2, 0x2945, 0x8012, 0x31A6, 0x0001, 0x18E3,
+0x8015, 0x0000, 0x8013, 0x0000, 0x0001, 0xAD55, 0x801C, 0xFFDF, 0x0001, 0x9492, 0x800E, 0x0000, 0x0001, 0x738E, 0x8003, 0xFFDF,
+0x0001, 0xC638, 0x800F, 0x0000, 0x0001, 0x8430, 0x8003, 0xFFDF, 0x0002, 0xF7BE, 0x6B4D, 0x8012, 0x0000, 0x0002, 0x0841, 0xEF5D,
+0x8003, 0xFFDF, 0x0001, 0x4A69, 0x8003, 0x0000, 0x0001, 0xB5B6, 0x8015, 0xFFDF, 0x0001, 0xCE59, 0x8015, 0x0000, 0x0004, 0x4228,
+0xA514, 0xD6BA, 0xF7BE, 0x8012, 0xFFDF, 0x0001, 0xCE38, 0x8006, 0x0000, 0x0003, 0x630C, 0xBDD7, 0xEF5D, 0x8012, 0xFFDF, 0x0003,
+0xD6BA, 0x9CD3, 0x2945, 0x8005, 0x0000, 0x0001, 0x6B2C, 0x8004, 0xFFDF, 0x0001, 0x632C, 0x801F, 0x0000, 0x0001, 0xBDD7, 0x8003,
+0xFFDF, 0x0001, 0x8430, 0x800F, 0x0000, 0x0004, 0x0841, 0x8410, 0xCE59, 0xF79E, 0x8013, 0xFFDF, 0x0001, 0xCE79, 0x8015, 0x0000,
+0x8013, 0x0000, 0x0001, 0xBDD7, 0x801C, 0xFFDF, 0x0001, 0xA4F3, 0x800D, 0x0000, 0x0001, 0x20E3, 0x8005, 0xFFDF, 0x0001, 0x7BAE,
+0x800E, 0x0000, 0x0001, 0x94B2, 0x8005, 0xFFDF, 0x0002, 0xA534, 0x0841, 0x8010, 0x0000, 0x0002, 0x0861, 0xF79E, 0x8003, 0xFFDF,
+0x0001, 0x62EB, 0x8003, 0x0000, 0x0001, 0xC638, 0x8015, 0xFFDF, 0x0001, 0xD69A, 0x8014, 0x0000, 0x0001, 0xA514, 0x8016, 0xFFDF,
+0x0001, 0xD69A, 0x8005, 0x0000, 0x0001, 0xB596, 0x8018, 0xFFDF, 0x0001, 0x5ACB, 0x8004, 0x0000, 0x0001, 0x7BCF, 0x8004, 0xFFDF,
+0x0001, 0x738E, 0x801E, 0x0000, 0x0001, 0x630C, 0x8005, 0xFFDF, 0x0001, 0x2945, 0x800D, 0x0000, 0x0002, 0x20E3, 0xDEFB, 0x8016,
+0xFFDF, 0x0001, 0xDEDB, 0x8015, 0x0000, 0x8013, 0x0000, 0x0001, 0xC618, 0x801C, 0xFFDF, 0x0001, 0xAD55, 0x800D, 0x0000, 0x0001,
+0xCE79, 0x8006, 0xFFDF, 0x0001, 0x2104, 0x800D, 0x0000, 0x0001, 0x8C51, 0x8006, 0xFFDF, 0x0002, 0xDEDB, 0x39C7, 0x800F, 0x0000,
+0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8015, 0xFFDF, 0x0001, 0xEF3C, 0x8013,
+0x0000, 0x0001, 0x7BEF, 0x8017, 0xFFDF, 0x0001, 0xE73C, 0x8004, 0x0000, 0x0001, 0x8C51, 0x801A, 0xFFDF, 0x0001, 0x2104, 0x8003,
+0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x801D, 0x0000, 0x0001, 0x1082, 0x8006, 0xFFDF, 0x0001, 0xDEDB, 0x800D,
+0x0000, 0x0001, 0xDEDB, 0x8017, 0xFFDF, 0x0001, 0xEF7D, 0x8015, 0x0000, 0x8013, 0x0000, 0x0001, 0x9CD3, 0x8011, 0xFFBE, 0x0003,
+0xF7BE, 0xE6FB, 0xDEFB, 0x8007, 0xFFDF, 0x0002, 0xD6BA, 0x39C7, 0x800C, 0x0000, 0x0001, 0x738E, 0x8007, 0xFFDF, 0x0001, 0xCE79,
+0x800D, 0x0000, 0x0001, 0x8C51, 0x8008, 0xFFDF, 0x0001, 0x6B6D, 0x800E, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001,
+0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8004, 0xFFDF, 0x0002, 0xBDD7, 0xB596, 0x800F, 0xB5B6, 0x0001, 0x8410, 0x8012, 0x0000,
+0x0002, 0x0841, 0xF79E, 0x8004, 0xFFDF, 0x0004, 0xF79E, 0xC638, 0xB5B6, 0xB596, 0x800F, 0xB5B6, 0x0001, 0x8410, 0x8003, 0x0000,
+0x0001, 0x0861, 0x8005, 0xFFDF, 0x0003, 0xE71C, 0xBDD7, 0xB596, 0x800C, 0xB5B6, 0x0002, 0xB596, 0xC618, 0x8005, 0xFFDF, 0x0001,
+0x94B2, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x801D, 0x0000, 0x0001, 0xBDF7, 0x8007, 0xFFDF, 0x0001,
+0x8410, 0x800B, 0x0000, 0x0001, 0x4228, 0x8005, 0xFFDF, 0x0003, 0xD69A, 0xB5B6, 0xB596, 0x8010, 0xB5B6, 0x0001, 0x8410, 0x8015,
+0x0000, 0x8014, 0x0000, 0x8010, 0x18C3, 0x0004, 0x10A2, 0x0000, 0x2965, 0xC618, 0x8006, 0xFFDF, 0x0002, 0x94B2, 0x0020, 0x800C,
+0x0000, 0x0001, 0x18E3, 0x8009, 0xFFDF, 0x0001, 0x738E, 0x800C, 0x0000, 0x0001, 0x8C51, 0x8009, 0xFFDF, 0x0002, 0xAD34, 0x0861,
+0x800C, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0001,
+0xF79E, 0x8024, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0002, 0xCE79, 0x18C3, 0x8016, 0x0000, 0x0001, 0x31A6, 0x8004, 0xFFDF,
+0x0002, 0xC618, 0x0841, 0x8010, 0x0000, 0x0001, 0x4228, 0x8004, 0xFFDF, 0x0001, 0xCE59, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004,
+0xFFDF, 0x0001, 0x6B4D, 0x801C, 0x0000, 0x0001, 0x62EB, 0x8009, 0xFFDF, 0x0001, 0x2945, 0x800A, 0x0000, 0x0001, 0x7BEF, 0x8004,
+0xFFDF, 0x0001, 0x8430, 0x8029, 0x0000, 0x8025, 0x0000, 0x0002, 0x3186, 0xD69A, 0x8005, 0xFFDF, 0x0002, 0xE73C, 0x528A, 0x800E,
+0x0000, 0x0001, 0xCE59, 0x8004, 0xFFDF, 0x0002, 0x8430, 0xDEFB, 0x8004, 0xFFDF, 0x0001, 0x18E3, 0x800B, 0x0000, 0x0001, 0x8C51,
+0x8003, 0xFFDF, 0x0001, 0xE73C, 0x8006, 0xFFDF, 0x0002, 0xDEDB, 0x39C7, 0x800B, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF,
+0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0002, 0xF79E, 0x1082, 0x8023, 0x0000, 0x0001, 0x2945, 0x8004,
+0xFFDF, 0x0001, 0xA514, 0x8017, 0x0000, 0x0001, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x7BCF, 0x8012, 0x0000, 0x0001, 0xEF7D, 0x8003,
+0xFFDF, 0x0001, 0xD69A, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x801B, 0x0000, 0x0001, 0x0861, 0x8004,
+0xFFDF, 0x0002, 0xF79E, 0x8430, 0x8004, 0xFFDF, 0x0001, 0xD6BA, 0x800A, 0x0000, 0x0001, 0x8C51, 0x8004, 0xFFDF, 0x0001, 0x2945,
+0x8029, 0x0000, 0x8024, 0x0000, 0x0001, 0x8C71, 0x8006, 0xFFDF, 0x0002, 0xAD75, 0x10A2, 0x800E, 0x0000, 0x0001, 0x6B6D, 0x8004,
+0xFFDF, 0x0003, 0xCE38, 0x0000, 0x52AA, 0x8004, 0xFFDF, 0x0001, 0xC638, 0x800B, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0003,
+0x9CF3, 0x31A6, 0xE71C, 0x8006, 0xFFDF, 0x0001, 0x738E, 0x800A, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001, 0x5ACB,
+0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0002, 0xF79E, 0x0861, 0x8023, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001,
+0xAD75, 0x8017, 0x0000, 0x0001, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002, 0x0861, 0xEF5D, 0x8003, 0xFFDF,
+0x0001, 0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x801B, 0x0000, 0x0001, 0xBDD7, 0x8004, 0xFFDF,
+0x0003, 0x738E, 0x0000, 0xB575, 0x8004, 0xFFDF, 0x0001, 0x7BEF, 0x8009, 0x0000, 0x0001, 0x8C51, 0x8004, 0xFFDF, 0x0001, 0x2945,
+0x8029, 0x0000, 0x8022, 0x0000, 0x0002, 0x39C7, 0xD6BA, 0x8005, 0xFFDF, 0x0002, 0xF7BE, 0x6B4D, 0x800F, 0x0000, 0x0001, 0x18C3,
+0x8005, 0xFFDF, 0x0004, 0x18E3, 0x0000, 0x0000, 0xCE59, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x800A, 0x0000, 0x0001, 0x8C51, 0x8003,
+0xFFDF, 0x0004, 0xBDD7, 0x0000, 0x0861, 0xAD55, 0x8006, 0xFFDF, 0x0002, 0xAD55, 0x0861, 0x8008, 0x0000, 0x0002, 0x0841, 0xEF3C,
+0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0001, 0xF79E, 0x8024, 0x0000, 0x0001, 0x2124,
+0x8004, 0xFFDF, 0x0001, 0xAD75, 0x8017, 0x0000, 0x0001, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002, 0x0861,
+0xEF7D, 0x8003, 0xFFDF, 0x0001, 0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x801A, 0x0000, 0x0001,
+0x630C, 0x8004, 0xFFDF, 0x0004, 0xD6BA, 0x0000, 0x0000, 0x1082, 0x8005, 0xFFDF, 0x0001, 0x2124, 0x8008, 0x0000, 0x0001, 0x7BEF,
+0x8004, 0xFFDF, 0x0002, 0x94B2, 0x1082, 0x8028, 0x0000, 0x8021, 0x0000, 0x0001, 0x7BAE, 0x8006, 0xFFDF, 0x0002, 0xC618, 0x2124,
+0x8010, 0x0000, 0x0001, 0xCE59, 0x8004, 0xFFDF, 0x0001, 0x73AE, 0x8003, 0x0000, 0x0001, 0x2104, 0x8005, 0xFFDF, 0x0001, 0x18C3,
+0x8009, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x8003, 0x0000, 0x0001, 0x738E, 0x8006, 0xFFDF, 0x0002, 0xE71C,
+0x39C7, 0x8007, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8004, 0xFFDF,
+0x0001, 0xC618, 0x800E, 0xBDF7, 0x0002, 0xC5F7, 0x9492, 0x8013, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001, 0xAD75, 0x8017,
+0x0000, 0x0001, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002, 0x0861, 0xEF7D, 0x8003, 0xFFDF, 0x0001, 0xCE79,
+0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x8019, 0x0000, 0x0001, 0x1082, 0x8005, 0xFFDF, 0x0001, 0x2945,
+0x8003, 0x0000, 0x0001, 0x630C, 0x8004, 0xFFDF, 0x0001, 0xD69A, 0x8008, 0x0000, 0x0001, 0x39E7, 0x8005, 0xFFDF, 0x0001, 0xEF7D,
+0x800D, 0xD6BA, 0x0004, 0xD69A, 0xC618, 0x9CD3, 0x528A, 0x8017, 0x0000, 0x801F, 0x0000, 0x0002, 0x20E3, 0xBDF7, 0x8006, 0xFFDF,
+0x0001, 0x7BEF, 0x8011, 0x0000, 0x0001, 0x6B6D, 0x8004, 0xFFDF, 0x0001, 0xD69A, 0x8005, 0x0000, 0x0001, 0x7BCF, 0x8004, 0xFFDF,
+0x0001, 0xC638, 0x8009, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x8004, 0x0000, 0x0002, 0x31A6, 0xD6BA, 0x8006,
+0xFFDF, 0x0001, 0x73AE, 0x8006, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7,
+0x8015, 0xFFDF, 0x8013, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001, 0xAD75, 0x800F, 0x0000, 0x0001, 0x4A49, 0x8003, 0x8C71,
+0x0005, 0x8410, 0x0861, 0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002, 0x0861, 0xEF7D, 0x8003,
+0xFFDF, 0x0001, 0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x8019, 0x0000, 0x0001, 0xBDD7, 0x8004,
+0xFFDF, 0x0001, 0x8C51, 0x8005, 0x0000, 0x0001, 0xCE59, 0x8004, 0xFFDF, 0x0001, 0x73AE, 0x8008, 0x0000, 0x0001, 0xCE59, 0x8016,
+0xFFDF, 0x0002, 0xD6BA, 0x31A6, 0x8015, 0x0000, 0x801E, 0x0000, 0x0002, 0x5AEB, 0xF7BE, 0x8005, 0xFFDF, 0x0002, 0xD6BA, 0x39C7,
+0x8011, 0x0000, 0x0001, 0x18E3, 0x8005, 0xFFDF, 0x0001, 0x2104, 0x8006, 0x0000, 0x0001, 0xD6BA, 0x8004, 0xFFDF, 0x0001, 0x6B4D,
+0x8008, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x8005, 0x0000, 0x0002, 0x0020, 0x9CF3, 0x8006, 0xFFDF, 0x0002,
+0xB596, 0x1082, 0x8004, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8014,
+0xFFDF, 0x0001, 0xEF3C, 0x8013, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001, 0xAD75, 0x800F, 0x0000, 0x0001, 0xB5B6, 0x8004,
+0xFFDF, 0x0004, 0x3186, 0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002, 0x0861, 0xEF7D, 0x8003,
+0xFFDF, 0x0001, 0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x8018, 0x0000, 0x0001, 0x5AEB, 0x8004,
+0xFFDF, 0x0001, 0xE71C, 0x8006, 0x0000, 0x0001, 0x18E3, 0x8005, 0xFFDF, 0x0001, 0x2104, 0x8007, 0x0000, 0x0002, 0x0861, 0xCE59,
+0x8017, 0xFFDF, 0x0001, 0x18E3, 0x8014, 0x0000, 0x801C, 0x0000, 0x0002, 0x0861, 0xAD55, 0x8006, 0xFFDF, 0x0001, 0x94B2, 0x8013,
+0x0000, 0x0001, 0xCE59, 0x8004, 0xFFDF, 0x0001, 0x8410, 0x8007, 0x0000, 0x0001, 0x2965, 0x8005, 0xFFDF, 0x0001, 0x10A2, 0x8007,
+0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x8007, 0x0000, 0x0002, 0x5ACB, 0xFFBE, 0x8005, 0xFFDF, 0x0002, 0xE73C,
+0x39E7, 0x8003, 0x0000, 0x0002, 0x0841, 0xEF3C, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8014, 0xFFDF,
+0x0001, 0xDEFB, 0x8013, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001, 0xAD75, 0x800F, 0x0000, 0x0001, 0x9CF3, 0x8004, 0xFFDF,
+0x0004, 0x2965, 0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002, 0x0861, 0xEF7D, 0x8003, 0xFFDF,
+0x0001, 0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x8017, 0x0000, 0x0001, 0x1082, 0x8005, 0xFFDF,
+0x0001, 0x31A6, 0x8007, 0x0000, 0x0001, 0x7BEF, 0x8004, 0xFFDF, 0x0001, 0xCE59, 0x8009, 0x0000, 0x0003, 0x630C, 0xBDD7, 0xE73C,
+0x8014, 0xFFDF, 0x0001, 0xAD55, 0x8014, 0x0000, 0x801B, 0x0000, 0x0002, 0x4A49, 0xE6FB, 0x8005, 0xFFDF, 0x0002, 0xEF5D, 0x528A,
+0x8013, 0x0000, 0x0001, 0x6B4D, 0x8004, 0xFFDF, 0x0001, 0xDEFB, 0x8009, 0x0000, 0x0001, 0x9492, 0x8004, 0xFFDF, 0x0001, 0xBDF7,
+0x8007, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x8008, 0x0000, 0x0002, 0x2124, 0xC638, 0x8006, 0xFFDF, 0x0005,
+0x7BCF, 0x0000, 0x0000, 0x0861, 0xEF5D, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0002,
+0xF79E, 0x4228, 0x800F, 0x31A6, 0x0001, 0x2104, 0x8013, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001, 0xAD75, 0x800F, 0x0000,
+0x0001, 0x9CF3, 0x8004, 0xFFDF, 0x0004, 0x2965, 0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002,
+0x0861, 0xEF7D, 0x8003, 0xFFDF, 0x0001, 0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x8017, 0x0000,
+0x0001, 0xB5B6, 0x8004, 0xFFDF, 0x0001, 0x9CF3, 0x8009, 0x0000, 0x0001, 0xD6BA, 0x8004, 0xFFDF, 0x0001, 0x6B6D, 0x800A, 0x0000,
+0x0002, 0x0841, 0x20E3, 0x800D, 0x2124, 0x0002, 0x2965, 0x6B4D, 0x8004, 0xFFDF, 0x0001, 0xE71C, 0x8014, 0x0000, 0x801A, 0x0000,
+0x0001, 0x8C71, 0x8006, 0xFFDF, 0x0002, 0xAD55, 0x10A2, 0x8013, 0x0000, 0x0001, 0x18C3, 0x8005, 0xFFDF, 0x0001, 0x2965, 0x800A,
+0x0000, 0x0001, 0xE73C, 0x8004, 0xFFDF, 0x0001, 0x630C, 0x8006, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x800A,
+0x0000, 0x0001, 0x8430, 0x8006, 0xFFDF, 0x0004, 0xB596, 0x0841, 0x0000, 0xEF5D, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000,
+0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0001, 0xF79E, 0x8024, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001, 0xAD75, 0x800F, 0x0000,
+0x0001, 0x9CF3, 0x8004, 0xFFDF, 0x0004, 0x2965, 0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002,
+0x0861, 0xEF7D, 0x8003, 0xFFDF, 0x0001, 0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x8016, 0x0000,
+0x0001, 0x5ACB, 0x8004, 0xFFDF, 0x0001, 0xEF7D, 0x800A, 0x0000, 0x0001, 0x2965, 0x8005, 0xFFDF, 0x0001, 0x2104, 0x801A, 0x0000,
+0x0001, 0xCE59, 0x8003, 0xFFDF, 0x0001, 0xEF7D, 0x8014, 0x0000, 0x8018, 0x0000, 0x0002, 0x31A6, 0xCE79, 0x8006, 0xFFDF, 0x0001,
+0x630C, 0x8015, 0x0000, 0x0001, 0xCE38, 0x8004, 0xFFDF, 0x0001, 0x9492, 0x800B, 0x0000, 0x0001, 0x4208, 0x8005, 0xFFDF, 0x0001,
+0x1082, 0x8005, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x800B, 0x0000, 0x0002, 0x4A49, 0xEF5D, 0x8005, 0xFFDF,
+0x0003, 0xDEDB, 0x4A69, 0xD679, 0x8003, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0002, 0xF79E,
+0x10A2, 0x8023, 0x0000, 0x0001, 0x2124, 0x8004, 0xFFDF, 0x0001, 0xAD75, 0x800F, 0x0000, 0x0001, 0x9CF3, 0x8004, 0xFFDF, 0x0004,
+0x2965, 0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8011, 0x0000, 0x0002, 0x0861, 0xEF7D, 0x8003, 0xFFDF, 0x0001,
+0xCE79, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x6B4D, 0x8015, 0x0000, 0x0002, 0x1082, 0xF7BE, 0x8004, 0xFFDF,
+0x0001, 0x4228, 0x800B, 0x0000, 0x0001, 0x9492, 0x8004, 0xFFDF, 0x0001, 0xCE59, 0x801A, 0x0000, 0x0001, 0xC618, 0x8003, 0xFFDF,
+0x0001, 0xEF5D, 0x8014, 0x0000, 0x8017, 0x0000, 0x0001, 0x738E, 0x8006, 0xFFDF, 0x0002, 0xC618, 0x2945, 0x8015, 0x0000, 0x0001,
+0x6B2C, 0x8004, 0xFFDF, 0x0001, 0xEF5D, 0x800D, 0x0000, 0x0001, 0xAD55, 0x8004, 0xFFDF, 0x0001, 0xBDD7, 0x8005, 0x0000, 0x0001,
+0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x800C, 0x0000, 0x0002, 0x18C3, 0xB596, 0x8006, 0xFFDF, 0x0001, 0xF77D, 0x8003, 0xFFDF,
+0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0002, 0xF79E, 0x10A2, 0x8023, 0x0000, 0x0001, 0x2124, 0x8004,
+0xFFDF, 0x0001, 0xAD75, 0x800F, 0x0000, 0x0001, 0x9CF3, 0x8004, 0xFFDF, 0x0004, 0x2965, 0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF,
+0x0001, 0x8410, 0x8011, 0x0000, 0x0002, 0x0841, 0xEF5D, 0x8003, 0xFFDF, 0x0001, 0xD69A, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004,
+0xFFDF, 0x0001, 0x6B4D, 0x8015, 0x0000, 0x0001, 0xBDD7, 0x8004, 0xFFDF, 0x0001, 0xA534, 0x800D, 0x0000, 0x0001, 0xEF3C, 0x8004,
+0xFFDF, 0x0001, 0x6B4D, 0x8019, 0x0000, 0x0001, 0xC618, 0x8003, 0xFFDF, 0x0001, 0xEF5D, 0x8014, 0x0000, 0x8015, 0x0000, 0x0002,
+0x18E3, 0xB5B6, 0x8005, 0xFFDF, 0x0002, 0xDEDB, 0x4A69, 0x8016, 0x0000, 0x0001, 0x10A2, 0x8005, 0xFFDF, 0x0001, 0x39E7, 0x800D,
+0x0000, 0x0002, 0x0861, 0xF79E, 0x8004, 0xFFDF, 0x0001, 0x5ACB, 0x8004, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7,
+0x800E, 0x0000, 0x0001, 0x73AE, 0x8009, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0001, 0xF79E,
+0x8024, 0x0000, 0x0001, 0x2945, 0x8004, 0xFFDF, 0x0001, 0xAD34, 0x800F, 0x0000, 0x0001, 0x94B2, 0x8004, 0xFFDF, 0x0004, 0x3186,
+0x0000, 0x0000, 0x4208, 0x8004, 0xFFDF, 0x0001, 0x8C51, 0x8012, 0x0000, 0x0001, 0xF79E, 0x8003, 0xFFDF, 0x0001, 0xD69A, 0x8003,
+0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x5ACB, 0x8014, 0x0000, 0x0001, 0x5AEB, 0x8004, 0xFFDF, 0x0002, 0xF79E, 0x0841,
+0x800D, 0x0000, 0x0001, 0x4208, 0x8005, 0xFFDF, 0x0001, 0x18C3, 0x8018, 0x0000, 0x0001, 0xCE79, 0x8003, 0xFFDF, 0x0001, 0xEF7D,
+0x8014, 0x0000, 0x8014, 0x0000, 0x0002, 0x5AEB, 0xF77D, 0x8006, 0xFFDF, 0x0003, 0xB575, 0x528A, 0x6B4D, 0x8011, 0x73AE, 0x0001,
+0x31A6, 0x8003, 0x0000, 0x0001, 0xC638, 0x8004, 0xFFDF, 0x0001, 0xA4F3, 0x800F, 0x0000, 0x0001, 0x52AA, 0x8005, 0xFFDF, 0x0001,
+0x0861, 0x8003, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7, 0x800F, 0x0000, 0x0002, 0x39C7, 0xDEDB, 0x8007, 0xFFDF,
+0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8003, 0xFFDF, 0x0002, 0xF79E, 0x39E7, 0x800F, 0x2965, 0x0002, 0x3186, 0x18C3,
+0x8012, 0x0000, 0x0001, 0x18E3, 0x8004, 0xFFDF, 0x0003, 0xE73C, 0x738E, 0x4208, 0x800B, 0x2965, 0x0003, 0x39E7, 0x6B6D, 0xDEFB,
+0x8004, 0xFFDF, 0x0004, 0x2124, 0x0000, 0x0000, 0x2945, 0x8004, 0xFFDF, 0x0003, 0xE73C, 0x630C, 0x3186, 0x800E, 0x2965, 0x0002,
+0x39E7, 0x9CD3, 0x8004, 0xFFDF, 0x0001, 0xBDF7, 0x8003, 0x0000, 0x0001, 0x736D, 0x8004, 0xFFDF, 0x0001, 0x8430, 0x8010, 0x2965,
+0x0005, 0x0841, 0x0000, 0x0000, 0x1082, 0xFFBE, 0x8004, 0xFFDF, 0x0001, 0x4A69, 0x800F, 0x0000, 0x0001, 0xAD55, 0x8004, 0xFFDF,
+0x0001, 0xC638, 0x8003, 0x0000, 0x0002, 0x10A2, 0x3186, 0x8011, 0x2965, 0x0002, 0x31A6, 0x7BCF, 0x8004, 0xFFDF, 0x0001, 0xE71C,
+0x8014, 0x0000, 0x8013, 0x0000, 0x0001, 0x8410, 0x801C, 0xFFDF, 0x0004, 0xAD34, 0x0000, 0x0000, 0x630C, 0x8004, 0xFFDF, 0x0001,
+0xEF7D, 0x8011, 0x0000, 0x0001, 0xBDF7, 0x8004, 0xFFDF, 0x0001, 0xB5B6, 0x8003, 0x0000, 0x0001, 0x8C51, 0x8003, 0xFFDF, 0x0001,
+0xBDD7, 0x8010, 0x0000, 0x0002, 0x0020, 0xA534, 0x8006, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8015, 0xFFDF,
+0x0001, 0xC638, 0x8013, 0x0000, 0x0001, 0xD6BA, 0x8017, 0xFFDF, 0x0001, 0xE73C, 0x8004, 0x0000, 0x0001, 0xE73C, 0x801A, 0xFFDF,
+0x0001, 0x6B4D, 0x8003, 0x0000, 0x0001, 0x736D, 0x8015, 0xFFDF, 0x0004, 0x8C51, 0x0000, 0x0000, 0xB5B6, 0x8004, 0xFFDF, 0x0001,
+0xB596, 0x8010, 0x0000, 0x0002, 0x0861, 0xF7BE, 0x8004, 0xFFDF, 0x0004, 0x632C, 0x0000, 0x0000, 0xCE79, 0x8018, 0xFFDF, 0x0001,
+0xA514, 0x8014, 0x0000, 0x8013, 0x0000, 0x0001, 0xCE59, 0x801C, 0xFFDF, 0x0003, 0x9CF3, 0x0000, 0x18C3, 0x8005, 0xFFDF, 0x0001,
+0x4A49, 0x8011, 0x0000, 0x0001, 0x10A2, 0x8005, 0xFFDF, 0x0004, 0x52AA, 0x0000, 0x0000, 0x8C51, 0x8003, 0xFFDF, 0x0001, 0xBDD7,
+0x8012, 0x0000, 0x0001, 0x632C, 0x8005, 0xFFDF, 0x0001, 0x5ACB, 0x8003, 0x0000, 0x0001, 0xBDD7, 0x8015, 0xFFDF, 0x0001, 0xD6BA,
+0x8013, 0x0000, 0x0001, 0x4208, 0x8017, 0xFFDF, 0x0001, 0x528A, 0x8004, 0x0000, 0x0001, 0x4A49, 0x8019, 0xFFDF, 0x0002, 0xD6BA,
+0x0020, 0x8003, 0x0000, 0x0001, 0x736D, 0x8015, 0xFFDF, 0x0003, 0xA514, 0x0000, 0x52AA, 0x8004, 0xFFDF, 0x0002, 0xFFBE, 0x1082,
+0x8011, 0x0000, 0x0001, 0x5ACB, 0x8005, 0xFFDF, 0x0003, 0x0861, 0x0000, 0xE71C, 0x8017, 0xFFDF, 0x0002, 0xF7BE, 0x18C3, 0x8014,
+0x0000, 0x8013, 0x0000, 0x0001, 0xCE59, 0x801C, 0xFFDF, 0x0003, 0x9CF3, 0x0000, 0xE73C, 0x8004, 0xFFDF, 0x0001, 0xAD55, 0x8013,
+0x0000, 0x0001, 0x6B6D, 0x8005, 0xFFDF, 0x0003, 0x2965, 0x0000, 0xA514, 0x8003, 0xFFDF, 0x0001, 0xDEDB, 0x8013, 0x0000, 0x0002,
+0x2945, 0xCE59, 0x8003, 0xFFDF, 0x0001, 0x632C, 0x8003, 0x0000, 0x0001, 0xD6BA, 0x8015, 0xFFDF, 0x0001, 0xE73C, 0x8014, 0x0000,
+0x0002, 0x4A49, 0xCE79, 0x8013, 0xFFDF, 0x0002, 0xD6BA, 0x52AA, 0x8006, 0x0000, 0x0002, 0x5ACB, 0xE71C, 0x8016, 0xFFDF, 0x0002,
+0xB596, 0x0861, 0x8004, 0x0000, 0x0001, 0x8410, 0x8015, 0xFFDF, 0x0002, 0x8C51, 0x18C3, 0x8005, 0xFFDF, 0x0001, 0x5AEB, 0x8013,
+0x0000, 0x0001, 0xBDF7, 0x8004, 0xFFDF, 0x0003, 0xD6BA, 0x0841, 0xE73C, 0x8016, 0xFFDF, 0x0002, 0xCE59, 0x2965, 0x8015, 0x0000,
+0x8013, 0x0000, 0x0002, 0x73AE, 0xC5F7, 0x801B, 0xBDF7, 0x0008, 0x4A69, 0x0000, 0xCE79, 0xC5F7, 0xBDF7, 0xC5F7, 0xB5B6, 0x0841,
+0x8014, 0x0000, 0x000C, 0xA514, 0xC5F7, 0xBDF7, 0xBDF7, 0xCE59, 0x4228, 0x0000, 0x5ACB, 0xBDF7, 0xBDF7, 0xC5F7, 0x7BEF, 0x8015,
+0x0000, 0x0004, 0x8C51, 0xC5F7, 0xBDF7, 0x3186, 0x8003, 0x0000, 0x0002, 0x7BCF, 0xC5F7, 0x8013, 0xBDF7, 0x0002, 0xC5F7, 0x8C51,
+0x8016, 0x0000, 0x0004, 0x4228, 0x8430, 0xA534, 0xB5B6, 0x800B, 0xBDF7, 0x0004, 0xB5B6, 0xA534, 0x8430, 0x4A49, 0x8009, 0x0000,
+0x0006, 0x0841, 0x630C, 0x9CD3, 0xB596, 0xBDF7, 0xC5F7, 0x800D, 0xBDF7, 0x0004, 0xBDD7, 0xAD55, 0x8430, 0x39C7, 0x8006, 0x0000,
+0x0001, 0x4228, 0x8015, 0xBDF7, 0x0007, 0x39C7, 0x2945, 0xCE79, 0xBDF7, 0xBDF7, 0xC5F7, 0x94B2, 0x8014, 0x0000, 0x0009, 0x18C3,
+0xBDD7, 0xC5F7, 0xBDF7, 0xC5F7, 0xC618, 0x0861, 0x7BEF, 0xC5F7, 0x8010, 0xBDF7, 0x0005, 0xC5F7, 0xBDF7, 0xAD75, 0x9492, 0x4A69,
+0x8017, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000,
+};
@@ -0,0 +1,32 @@
+// Generated by   : tools/compress_images.py
+// Generated from : OkButtonDefault.c
+// Image Size     : 144x50 pixels
+// Memory usage   : 704 bytes (14400 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short OkButtonDefaultRLE[352] ={
+0x807E, 0x0744, 0x0001, 0x0724, 0x8011, 0x0000, 0x807F, 0x0744, 0x0001, 0x0724, 0x8010, 0x0000, 0x8081, 0x0744, 0x800F, 0x0000,
+0x8082, 0x0744, 0x0001, 0x0724, 0x800D, 0x0000, 0x8083, 0x0744, 0x0001, 0x0724, 0x800C, 0x0000, 0x8085, 0x0744, 0x800B, 0x0000,
+0x8086, 0x0744, 0x800A, 0x0000, 0x8087, 0x0744, 0x0001, 0x0724, 0x8008, 0x0000, 0x8089, 0x0744, 0x8007, 0x0000, 0x808A, 0x0744,
+0x8006, 0x0000, 0x808B, 0x0744, 0x0001, 0x06E4, 0x8004, 0x0000, 0x808C, 0x0744, 0x0001, 0x0724, 0x8003, 0x0000, 0x808D, 0x0744,
+0x0003, 0x0724, 0x0000, 0x0000, 0x808E, 0x0744, 0x0002, 0x8D76, 0x0000, 0x808E, 0x0744, 0x0002, 0x9576, 0x9556, 0x808E, 0x0744,
+0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002,
+0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576,
+0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576,
+0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E,
+0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744,
+0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002, 0x9576, 0x9576, 0x808E, 0x0744, 0x0002,
+0x9576, 0x9576, 0x0001, 0x0724, 0x808D, 0x0744, 0x0002, 0x9576, 0x9576, 0x0003, 0x0000, 0x06E4, 0x2EA9, 0x808B, 0x0744, 0x0002,
+0x9576, 0x9576, 0x0004, 0x0000, 0x0000, 0x9536, 0x3E8B, 0x808A, 0x0744, 0x0002, 0x9576, 0x9576, 0x8003, 0x0000, 0x0002, 0x8D75,
+0x2EC9, 0x8089, 0x0744, 0x0002, 0x9576, 0x9576, 0x8005, 0x0000, 0x0001, 0x26C8, 0x8088, 0x0744, 0x0002, 0x9576, 0x9576, 0x8006,
+0x0000, 0x0002, 0x4E4D, 0x0F25, 0x8086, 0x0744, 0x0002, 0x9576, 0x9576, 0x8007, 0x0000, 0x0002, 0x6DD1, 0x1706, 0x8085, 0x0744,
+0x0002, 0x9576, 0x9576, 0x8008, 0x0000, 0x0002, 0x5E0F, 0x0F05, 0x8084, 0x0744, 0x0002, 0x9576, 0x9576, 0x8009, 0x0000, 0x0002,
+0x366B, 0x0F05, 0x8083, 0x0744, 0x0002, 0x9576, 0x9576, 0x800A, 0x0000, 0x0002, 0x562D, 0x26C8, 0x8082, 0x0744, 0x0002, 0x9576,
+0x9576, 0x800B, 0x0000, 0x0002, 0x9536, 0x466C, 0x8060, 0x0744, 0x0001, 0x4E4D, 0x8011, 0x9576, 0x0001, 0x8594, 0x800E, 0x0744,
+0x0002, 0x9576, 0x9576, 0x800C, 0x0000, 0x0002, 0x8D75, 0x2EC9, 0x805F, 0x0744, 0x0001, 0x4E4D, 0x8011, 0x9576, 0x0001, 0x8594,
+0x800E, 0x0744, 0x0002, 0x9576, 0x9576, 0x800E, 0x0000, 0x0001, 0x26C8, 0x805E, 0x0744, 0x0003, 0x4E4D, 0x9576, 0x9556, 0x800F,
+0x0000, 0x0001, 0x0724, 0x800E, 0x0744, 0x0002, 0x9576, 0x9576, 0x800F, 0x0000, 0x0001, 0x9556, 0x805F, 0x9576, 0x0001, 0x9556,
+0x8012, 0x0000, 0x800E, 0x9576, 0x8010, 0x0000, 0x0001, 0x9556, 0x805E, 0x9576, 0x0001, 0x9556, 0x8012, 0x0000, 0x800E, 0x9576,
+};
@@ -0,0 +1,31 @@
+// Generated by   : tools/compress_images.py
+// Generated from : SelectButtonDefault.c
+// Image Size     : 144x50 pixels
+// Memory usage   : 666 bytes (14400 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short SelectButtonDefaultRLE[333] ={
+0x807F, 0xFA80, 0x8011, 0x0000, 0x8080, 0xFA80, 0x8010, 0x0000, 0x8081, 0xFA80, 0x800F, 0x0000, 0x8083, 0xFA80, 0x800D, 0x0000,
+0x8084, 0xFA80, 0x800C, 0x0000, 0x8085, 0xFA80, 0x800B, 0x0000, 0x8086, 0xFA80, 0x800A, 0x0000, 0x8088, 0xFA80, 0x8008, 0x0000,
+0x8089, 0xFA80, 0x8007, 0x0000, 0x808A, 0xFA80, 0x8006, 0x0000, 0x808C, 0xFA80, 0x8004, 0x0000, 0x808D, 0xFA80, 0x8003, 0x0000,
+0x808E, 0xFA80, 0x0002, 0x0000, 0x0000, 0x808E, 0xFA80, 0x0002, 0x8D76, 0x0000, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9556, 0x808E,
+0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80,
+0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002,
+0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576,
+0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576,
+0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E,
+0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x808E, 0xFA80,
+0x0002, 0x9576, 0x9576, 0x808E, 0xFA80, 0x0002, 0x9576, 0x9576, 0x0003, 0x0000, 0xFA80, 0xE346, 0x808B, 0xFA80, 0x0002, 0x9576,
+0x9576, 0x0004, 0x0000, 0x0000, 0x9536, 0xD3A8, 0x808A, 0xFA80, 0x0002, 0x9576, 0x9576, 0x8003, 0x0000, 0x0002, 0x8D75, 0xE346,
+0x8089, 0xFA80, 0x0002, 0x9576, 0x9576, 0x8005, 0x0000, 0x0001, 0xE305, 0x8088, 0xFA80, 0x0002, 0x9576, 0x9576, 0x8006, 0x0000,
+0x0002, 0xCBEB, 0xFAA1, 0x8086, 0xFA80, 0x0002, 0x9576, 0x9576, 0x8007, 0x0000, 0x0002, 0xB490, 0xF2E2, 0x8085, 0xFA80, 0x0002,
+0x9576, 0x9576, 0x8008, 0x0000, 0x0002, 0xBC4E, 0xFAA1, 0x8084, 0xFA80, 0x0002, 0x9576, 0x9576, 0x8009, 0x0000, 0x0002, 0xDB87,
+0xFAA1, 0x8083, 0xFA80, 0x0002, 0x9576, 0x9576, 0x800A, 0x0000, 0x0002, 0xCC0B, 0xEB05, 0x8082, 0xFA80, 0x0002, 0x9576, 0x9576,
+0x800B, 0x0000, 0x0002, 0x9536, 0xD3C9, 0x8060, 0xFA80, 0x0001, 0xCBEB, 0x8011, 0x9576, 0x0001, 0xA514, 0x800E, 0xFA80, 0x0002,
+0x9576, 0x9576, 0x800C, 0x0000, 0x0002, 0x8D75, 0xE346, 0x805F, 0xFA80, 0x0001, 0xCBEB, 0x8011, 0x9576, 0x0001, 0xA514, 0x800E,
+0xFA80, 0x0002, 0x9576, 0x9576, 0x800E, 0x0000, 0x0001, 0xE305, 0x805E, 0xFA80, 0x0003, 0xCBEB, 0x9576, 0x9556, 0x800F, 0x0000,
+0x800F, 0xFA80, 0x0002, 0x9576, 0x9576, 0x800F, 0x0000, 0x0001, 0x9556, 0x805F, 0x9576, 0x0001, 0x9556, 0x8012, 0x0000, 0x800E,
+0x9576, 0x8010, 0x0000, 0x0001, 0x9556, 0x805E, 0x9576, 0x0001, 0x9556, 0x8012, 0x0000, 0x800E, 0x9576,
+};
@@ -0,0 +1,25 @@
+// Generated by   : tools/compress_images.py
+// Generated from : SelectButtonPressed.c
+// Image Size     : 144x50 pixels
+// Memory usage   : 466 bytes (14400 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short SelectButtonPressedRLE[233] ={
+0x807E, 0x9576, 0x0001, 0x8D76, 0x8011, 0x0000, 0x807F, 0x9576, 0x0001, 0x9556, 0x8010, 0x0000, 0x8081, 0x9576, 0x800F, 0x0000,
+0x8081, 0x9576, 0x0002, 0x9577, 0x8D76, 0x800D, 0x0000, 0x8083, 0x9576, 0x0001, 0x8D76, 0x800C, 0x0000, 0x8084, 0x9576, 0x0001,
+0x9556, 0x800B, 0x0000, 0x8086, 0x9576, 0x800A, 0x0000, 0x8086, 0x9576, 0x0002, 0x9556, 0x8D76, 0x8008, 0x0000, 0x8088, 0x9576,
+0x0001, 0x9557, 0x8007, 0x0000, 0x808A, 0x9576, 0x8006, 0x0000, 0x808A, 0x9576, 0x0002, 0x9557, 0x8CF5, 0x8004, 0x0000, 0x808C,
+0x9576, 0x0001, 0x8D76, 0x8003, 0x0000, 0x808D, 0x9576, 0x0003, 0x9556, 0x0000, 0x0000, 0x808E, 0x9576, 0x0002, 0x8D76, 0x0000,
+0x808F, 0x9576, 0x0001, 0x9556, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576,
+0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576,
+0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x8090, 0x9576, 0x0001, 0x9556, 0x808F, 0x9576, 0x0001, 0x9536,
+0x808F, 0x9576, 0x0003, 0x0000, 0x8D75, 0x9556, 0x808D, 0x9576, 0x0003, 0x0000, 0x0000, 0x9536, 0x808D, 0x9576, 0x8003, 0x0000,
+0x0002, 0x8D75, 0x9577, 0x808B, 0x9576, 0x8005, 0x0000, 0x808B, 0x9576, 0x8006, 0x0000, 0x0001, 0x9556, 0x8089, 0x9576, 0x8007,
+0x0000, 0x0001, 0x9556, 0x8088, 0x9576, 0x8008, 0x0000, 0x8088, 0x9576, 0x8009, 0x0000, 0x0002, 0x9557, 0x9556, 0x8085, 0x9576,
+0x800A, 0x0000, 0x0002, 0x9536, 0x9556, 0x8084, 0x9576, 0x800B, 0x0000, 0x0002, 0x9536, 0x9556, 0x8083, 0x9576, 0x800C, 0x0000,
+0x0002, 0x8D75, 0x9577, 0x8082, 0x9576, 0x800E, 0x0000, 0x8061, 0x9576, 0x0001, 0x9556, 0x800F, 0x0000, 0x0001, 0x9536, 0x8010,
+0x9576, 0x800F, 0x0000, 0x0001, 0x9556, 0x805F, 0x9576, 0x0001, 0x9556, 0x8012, 0x0000, 0x800E, 0x9576, 0x8010, 0x0000, 0x0001,
+0x9556, 0x805E, 0x9576, 0x0001, 0x9556, 0x8012, 0x0000, 0x800E, 0x9576,
+};
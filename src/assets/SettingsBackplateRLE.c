@@ -0,0 +1,46 @@
+// Generated by   : tools/compress_images.py
+// Generated from : SettingsBackplate.c
+// Image Size     : 320x240 pixels
+// Memory usage   : 1148 bytes (153600 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short SettingsBackplateRLE[574] ={
+0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x80A7, 0x0000,
+0x0001, 0xCA00, 0x8098, 0xFA80, 0x80A7, 0x0000, 0x0001, 0x40A0, 0x8098, 0xFA80, 0x80A8, 0x0000, 0x0001, 0x9160, 0x8097, 0xFA80,
+0x80A8, 0x0000, 0x0002, 0x1020, 0xDA20, 0x8096, 0xFA80, 0x80A9, 0x0000, 0x0001, 0x40A0, 0x8096, 0xFA80, 0x80AA, 0x0000, 0x0001,
+0xA180, 0x8095, 0xFA80, 0x80AA, 0x0000, 0x0002, 0x1020, 0xEA60, 0x8094, 0xFA80, 0x80AB, 0x0000, 0x0001, 0x7100, 0x8094, 0xFA80,
+0x80AC, 0x0000, 0x0001, 0xB9E0, 0x8093, 0xFA80, 0x80AC, 0x0000, 0x0002, 0x2040, 0xEA60, 0x8092, 0xFA80, 0x80AD, 0x0000, 0x0001,
+0x7100, 0x8092, 0xFA80, 0x80AE, 0x0000, 0x0001, 0xB9E0, 0x8091, 0xFA80, 0x80AE, 0x0000, 0x0001, 0x3060, 0x8091, 0xFA80, 0x80AF,
+0x0000, 0x0001, 0x8140, 0x8090, 0xFA80, 0x80AF, 0x0000, 0x0002, 0x1020, 0xDA20, 0x808F, 0xFA80, 0x80B0, 0x0000, 0x0001, 0x40A0,
+0x808F, 0xFA80, 0x80B1, 0x0000, 0x0001, 0x9160, 0x808E, 0xFA80, 0x80B1, 0x0000, 0x0002, 0x1020, 0xEA60, 0x808D, 0xFA80, 0x80B2,
+0x0000, 0x0001, 0x50C0, 0x808D, 0xFA80, 0x80B3, 0x0000, 0x0001, 0xB9E0, 0x808C, 0xFA80, 0x80B3, 0x0000, 0x0002, 0x2040, 0xEA60,
+0x808B, 0xFA80, 0x80B4, 0x0000, 0x0001, 0x7100, 0x808B, 0xFA80, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000, 0x8140, 0x0000,
+0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80, 0x8140, 0xFA80,
+};
@@ -0,0 +1,36 @@
+// Generated by   : tools/compress_images.py
+// Generated from : SettingsButtonDefault.c
+// Image Size     : 40x40 pixels
+// Memory usage   : 824 bytes (3200 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short SettingsButtonDefaultRLE[412] ={
+0x8028, 0x0000, 0x8028, 0x0000, 0x8028, 0x0000, 0x8011, 0x0000, 0x0001, 0xFA80, 0x8004, 0x0000, 0x0001, 0xFA80, 0x8011, 0x0000,
+0x8010, 0x0000, 0x8003, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8003, 0xFA80, 0x8010, 0x0000, 0x800C, 0x0000, 0x0004, 0xFA80, 0xFA80,
+0x0000, 0x0000, 0x8003, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8003, 0xFA80, 0x0004, 0x0000, 0x0000, 0xFA80, 0xFA80, 0x800C, 0x0000,
+0x800B, 0x0000, 0x8003, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8008, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8003, 0xFA80, 0x800B, 0x0000,
+0x800B, 0x0000, 0x8012, 0xFA80, 0x800B, 0x0000, 0x8008, 0x0000, 0x0003, 0xFA80, 0x0000, 0x0000, 0x8012, 0xFA80, 0x800B, 0x0000,
+0x8007, 0x0000, 0x801A, 0xFA80, 0x8007, 0x0000, 0x8007, 0x0000, 0x800A, 0xFA80, 0x8006, 0x0000, 0x800A, 0xFA80, 0x8007, 0x0000,
+0x8007, 0x0000, 0x800B, 0xFA80, 0x8007, 0x0000, 0x8008, 0xFA80, 0x8007, 0x0000, 0x8008, 0x0000, 0x800A, 0xFA80, 0x8009, 0x0000,
+0x8005, 0xFA80, 0x8008, 0x0000, 0x8005, 0x0000, 0x8007, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8005, 0xFA80, 0x8009, 0x0000, 0x8007,
+0xFA80, 0x8005, 0x0000, 0x8004, 0x0000, 0x8008, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8005, 0xFA80, 0x8009, 0x0000, 0x8008, 0xFA80,
+0x8004, 0x0000, 0x8004, 0x0000, 0x8007, 0xFA80, 0x8004, 0x0000, 0x8005, 0xFA80, 0x8009, 0x0000, 0x8007, 0xFA80, 0x8004, 0x0000,
+0x8005, 0x0000, 0x8006, 0xFA80, 0x8005, 0x0000, 0x8004, 0xFA80, 0x8009, 0x0000, 0x8006, 0xFA80, 0x8005, 0x0000, 0x8006, 0x0000,
+0x8004, 0xFA80, 0x8006, 0x0000, 0x8005, 0xFA80, 0x8008, 0x0000, 0x8005, 0xFA80, 0x8006, 0x0000, 0x8004, 0x0000, 0x8006, 0xFA80,
+0x8007, 0x0000, 0x8013, 0xFA80, 0x8004, 0x0000, 0x8003, 0x0000, 0x8007, 0xFA80, 0x8007, 0x0000, 0x8014, 0xFA80, 0x8003, 0x0000,
+0x8003, 0x0000, 0x8007, 0xFA80, 0x8007, 0x0000, 0x8014, 0xFA80, 0x8003, 0x0000, 0x8004, 0x0000, 0x8006, 0xFA80, 0x8007, 0x0000,
+0x8013, 0xFA80, 0x8004, 0x0000, 0x8006, 0x0000, 0x8004, 0xFA80, 0x8006, 0x0000, 0x8005, 0xFA80, 0x8008, 0x0000, 0x8005, 0xFA80,
+0x8006, 0x0000, 0x8005, 0x0000, 0x8006, 0xFA80, 0x8005, 0x0000, 0x8004, 0xFA80, 0x8009, 0x0000, 0x8006, 0xFA80, 0x8005, 0x0000,
+0x8004, 0x0000, 0x8007, 0xFA80, 0x8004, 0x0000, 0x8005, 0xFA80, 0x8009, 0x0000, 0x8007, 0xFA80, 0x8004, 0x0000, 0x8004, 0x0000,
+0x8008, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8005, 0xFA80, 0x8009, 0x0000, 0x8008, 0xFA80, 0x8004, 0x0000, 0x8005, 0x0000, 0x8007,
+0xFA80, 0x0002, 0x0000, 0x0000, 0x8005, 0xFA80, 0x8009, 0x0000, 0x8007, 0xFA80, 0x8005, 0x0000, 0x8008, 0x0000, 0x800A, 0xFA80,
+0x8009, 0x0000, 0x8005, 0xFA80, 0x8008, 0x0000, 0x8007, 0x0000, 0x800B, 0xFA80, 0x8007, 0x0000, 0x8008, 0xFA80, 0x8007, 0x0000,
+0x8007, 0x0000, 0x800A, 0xFA80, 0x8006, 0x0000, 0x800A, 0xFA80, 0x8007, 0x0000, 0x8007, 0x0000, 0x801A, 0xFA80, 0x8007, 0x0000,
+0x800B, 0x0000, 0x8012, 0xFA80, 0x800B, 0x0000, 0x800B, 0x0000, 0x8012, 0xFA80, 0x800B, 0x0000, 0x800B, 0x0000, 0x8003, 0xFA80,
+0x0002, 0x0000, 0x0000, 0x8008, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8003, 0xFA80, 0x800B, 0x0000, 0x800C, 0x0000, 0x0004, 0xFA80,
+0xFA80, 0x0000, 0x0000, 0x8003, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8003, 0xFA80, 0x0004, 0x0000, 0x0000, 0xFA80, 0xFA80, 0x800C,
+0x0000, 0x8010, 0x0000, 0x8003, 0xFA80, 0x0002, 0x0000, 0x0000, 0x8003, 0xFA80, 0x8010, 0x0000, 0x8011, 0x0000, 0x0001, 0xFA80,
+0x8004, 0x0000, 0x0001, 0xFA80, 0x8011, 0x0000, 0x8028, 0x0000, 0x8028, 0x0000, 0x8028, 0x0000,
+};
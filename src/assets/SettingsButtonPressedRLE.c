@@ -0,0 +1,51 @@
+// Generated by   : tools/compress_images.py
+// Generated from : SettingsButtonPressed.c
+// Image Size     : 40x40 pixels
+// Memory usage   : 1296 bytes (3200 bytes uncompressed)
+// Draw with      : lcdDrawImageRLE()
+
+#include <Arduino.h>
+
+FLASHMEM const unsigned short SettingsButtonPressedRLE[648] ={
+0x8028, 0x0000, 0x8028, 0x0000, 0x8028, 0x0000, 0x8011, 0x0000, 0x0001, 0x8D75, 0x8004, 0x0000, 0x0001, 0x8D75, 0x8011, 0x0000,
+0x8010, 0x0000, 0x0008, 0x9576, 0x9576, 0x9556, 0x0000, 0x0000, 0x9577, 0x9576, 0x9576, 0x8010, 0x0000, 0x800C, 0x0000, 0x0004,
+0x9556, 0x8CF5, 0x0000, 0x0000, 0x8003, 0x9576, 0x0002, 0x0000, 0x0000, 0x8003, 0x9576, 0x0004, 0x0000, 0x0000, 0x8D76, 0x9556,
+0x800C, 0x0000, 0x800B, 0x0000, 0x8003, 0x9576, 0x0002, 0x0000, 0x0000, 0x8003, 0x9576, 0x0002, 0x9556, 0x9577, 0x8003, 0x9576,
+0x0002, 0x0000, 0x0000, 0x8003, 0x9576, 0x800B, 0x0000, 0x800B, 0x0000, 0x8012, 0x9576, 0x800B, 0x0000, 0x8008, 0x0000, 0x0004,
+0x8D75, 0x0000, 0x0000, 0x9556, 0x8011, 0x9576, 0x800B, 0x0000, 0x8007, 0x0000, 0x8003, 0x9576, 0x0001, 0x8D76, 0x8008, 0x9576,
+0x0002, 0x9556, 0x9556, 0x8007, 0x9576, 0x0005, 0x9556, 0x8D75, 0x9577, 0x9576, 0x9556, 0x8007, 0x0000, 0x8007, 0x0000, 0x0001,
+0x9556, 0x8009, 0x9576, 0x8006, 0x0000, 0x0003, 0x9536, 0x9556, 0x9556, 0x8006, 0x9576, 0x0001, 0x9557, 0x8007, 0x0000, 0x8007,
+0x0000, 0x0001, 0x9556, 0x8009, 0x9576, 0x0001, 0x8CF5, 0x8007, 0x0000, 0x0002, 0x9536, 0x9577, 0x8005, 0x9576, 0x0001, 0x9557,
+0x8007, 0x0000, 0x8008, 0x0000, 0x0001, 0x9556, 0x8008, 0x9576, 0x0001, 0x9557, 0x8009, 0x0000, 0x0001, 0x9556, 0x8003, 0x9576,
+0x0001, 0x9556, 0x8008, 0x0000, 0x8005, 0x0000, 0x0001, 0x9577, 0x8003, 0x9556, 0x0006, 0x9576, 0x9576, 0x9577, 0x0000, 0x0000,
+0x9556, 0x8003, 0x9576, 0x0001, 0x9556, 0x8009, 0x0000, 0x8003, 0x9576, 0x0004, 0x9557, 0x9575, 0x9556, 0x9576, 0x8005, 0x0000,
+0x8004, 0x0000, 0x8006, 0x9576, 0x0005, 0x9556, 0x9536, 0x0000, 0x0000, 0x8D75, 0x8004, 0x9576, 0x8009, 0x0000, 0x0001, 0x8D75,
+0x8006, 0x9576, 0x0001, 0x9556, 0x8004, 0x0000, 0x8004, 0x0000, 0x0001, 0x9556, 0x8005, 0x9576, 0x0001, 0x9556, 0x8004, 0x0000,
+0x0001, 0x9556, 0x8003, 0x9576, 0x0001, 0x9556, 0x8009, 0x0000, 0x0001, 0x9556, 0x8006, 0x9576, 0x8004, 0x0000, 0x8005, 0x0000,
+0x0001, 0x9536, 0x8004, 0x9576, 0x0001, 0x9536, 0x8005, 0x0000, 0x0001, 0x9556, 0x8003, 0x9576, 0x8009, 0x0000, 0x0001, 0x8D75,
+0x8004, 0x9576, 0x0001, 0x9557, 0x8005, 0x0000, 0x8006, 0x0000, 0x0001, 0x8D75, 0x8003, 0x9576, 0x8006, 0x0000, 0x0001, 0x9556,
+0x8003, 0x9576, 0x0001, 0x9556, 0x8008, 0x0000, 0x0001, 0x8D75, 0x8003, 0x9576, 0x0001, 0x8CF5, 0x8006, 0x0000, 0x8004, 0x0000,
+0x0003, 0x9556, 0x9577, 0x9556, 0x8003, 0x9576, 0x8007, 0x0000, 0x8004, 0x9576, 0x0001, 0x9577, 0x800C, 0x9576, 0x0002, 0x9577,
+0x9556, 0x8004, 0x0000, 0x8003, 0x0000, 0x0001, 0x9556, 0x8005, 0x9576, 0x0001, 0x9556, 0x8007, 0x0000, 0x0001, 0x9556, 0x8012,
+0x9576, 0x0001, 0x9D57, 0x8003, 0x0000, 0x8003, 0x0000, 0x8006, 0x9576, 0x0001, 0x9556, 0x8007, 0x0000, 0x8013, 0x9576, 0x0001,
+0x9556, 0x8003, 0x0000, 0x8004, 0x0000, 0x0002, 0x9556, 0x9577, 0x8004, 0x9576, 0x8007, 0x0000, 0x0001, 0x9577, 0x800B, 0x9576,
+0x0001, 0x9556, 0x8004, 0x9576, 0x0002, 0x9577, 0x9556, 0x8004, 0x0000, 0x8006, 0x0000, 0x0001, 0x8D75, 0x8003, 0x9576, 0x8006,
+0x0000, 0x0001, 0x9556, 0x8003, 0x9576, 0x0001, 0x9556, 0x8008, 0x0000, 0x0001, 0x8D75, 0x8003, 0x9576, 0x0001, 0x8CF5, 0x8006,
+0x0000, 0x8005, 0x0000, 0x0001, 0x8D57, 0x8004, 0x9576, 0x0001, 0x8CF5, 0x8005, 0x0000, 0x8003, 0x9576, 0x0001, 0x9556, 0x8009,
+0x0000, 0x0001, 0x8D76, 0x8003, 0x9576, 0x0002, 0x9577, 0x8D76, 0x8005, 0x0000, 0x8004, 0x0000, 0x0001, 0x9556, 0x8005, 0x9576,
+0x0001, 0x9556, 0x8004, 0x0000, 0x0001, 0x9577, 0x8004, 0x9576, 0x8009, 0x0000, 0x0001, 0x9577, 0x8006, 0x9576, 0x8004, 0x0000,
+0x8004, 0x0000, 0x0001, 0x9556, 0x8006, 0x9576, 0x0004, 0x8CF5, 0x0000, 0x0000, 0x8D76, 0x8004, 0x9576, 0x8009, 0x0000, 0x0001,
+0x8D76, 0x8006, 0x9576, 0x0001, 0x9556, 0x8004, 0x0000, 0x8005, 0x0000, 0x0002, 0x9556, 0x9556, 0x8005, 0x9576, 0x0003, 0x0000,
+0x0000, 0x9556, 0x8003, 0x9576, 0x0001, 0x9536, 0x8009, 0x0000, 0x0001, 0x9577, 0x8003, 0x9576, 0x0003, 0x9557, 0x9576, 0x9577,
+0x8005, 0x0000, 0x8008, 0x0000, 0x0001, 0x9577, 0x8004, 0x9576, 0x0001, 0x9556, 0x8004, 0x9576, 0x8009, 0x0000, 0x8004, 0x9576,
+0x0001, 0x9556, 0x8008, 0x0000, 0x8007, 0x0000, 0x0001, 0x9556, 0x8009, 0x9576, 0x0001, 0x9536, 0x8007, 0x0000, 0x0002, 0x8D75,
+0x9577, 0x8005, 0x9576, 0x0001, 0x9556, 0x8007, 0x0000, 0x8007, 0x0000, 0x800A, 0x9576, 0x8006, 0x0000, 0x0001, 0x8D75, 0x8009,
+0x9576, 0x8007, 0x0000, 0x8007, 0x0000, 0x0005, 0x9556, 0x9576, 0x9576, 0x9CF5, 0x9577, 0x8007, 0x9576, 0x0002, 0x9556, 0x9556,
+0x8007, 0x9576, 0x0005, 0x9556, 0x9536, 0x9576, 0x9576, 0x9556, 0x8007, 0x0000, 0x800B, 0x0000, 0x0001, 0x9556, 0x8011, 0x9576,
+0x800B, 0x0000, 0x800B, 0x0000, 0x8003, 0x9576, 0x0001, 0x9556, 0x8009, 0x9576, 0x0001, 0x9556, 0x8004, 0x9576, 0x800B, 0x0000,
+0x800B, 0x0000, 0x000A, 0x9576, 0x9576, 0x9556, 0x0000, 0x0000, 0x9556, 0x9576, 0x9576, 0x9577, 0x9556, 0x8003, 0x9576, 0x0005,
+0x0000, 0x0000, 0x9576, 0x9576, 0x9557, 0x800B, 0x0000, 0x800C, 0x0000, 0x0009, 0x9576, 0x9CF5, 0x0000, 0x0000, 0x9576, 0x9576,
+0x9556, 0x0000, 0x0000, 0x8003, 0x9576, 0x0004, 0x0000, 0x0000, 0x9536, 0x9556, 0x800C, 0x0000, 0x8010, 0x0000, 0x8003, 0x9576,
+0x0005, 0x0000, 0x0000, 0x9556, 0x9576, 0x9556, 0x8010, 0x0000, 0x8011, 0x0000, 0x0001, 0x9CF5, 0x8004, 0x0000, 0x0001, 0x9CF5,
+0x8011, 0x0000, 0x8028, 0x0000, 0x8028, 0x0000, 0x8028, 0x0000,
+};
@@ -40,8 +40,8 @@ void loop() {
    mLidar->run();
    mDisplay->refresh();
 
-    // Prevent errors when incoming usb midi buffer is ignored
-    while(usbMIDI.read()){}
+    // Reading every loop also keeps the incoming usb midi buffer from filling up
+    mObjectTracker->processMidiInput();
 }
 
 
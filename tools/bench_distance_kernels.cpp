@@ -0,0 +1,138 @@
+//
+// bench_distance_kernels.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+// Host microbenchmark for the radius queries in src/ZGDistanceKernels.h. Every point of a synthetic revolution is
+// queried against all others, the way DBSCAN does, once with the old array of structs hypot comparison and once with
+// each kernel. Neighbour counts are checked against the hypot result before timings are printed.
+//
+// The packed kernel runs its portable fallback here, its timing on the Teensy comes from the DSP instructions.
+//
+// Usage:
+//   g++ -std=gnu++14 -O2 -march=native -Isrc tools/bench_distance_kernels.cpp -o bench_distance_kernels
+//   ./bench_distance_kernels [points] [radius_cm]
+//
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "ZGDistanceKernels.h"
+
+namespace {
+
+    struct Point {
+        float x;
+        float y;
+        int clusterID;
+        uint32_t time;
+    };
+
+    constexpr int REPEATS = 50;
+
+    template<typename Query>
+    double timeQueries(int inCount, long& outTotal, Query inQuery) {
+        auto best = 1e30;
+        for (int repeat = 0; repeat < REPEATS; repeat++) {
+            long total = 0;
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < inCount; i++) {
+                total += inQuery(i);
+            }
+            auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, elapsed);
+            outTotal = total;
+        }
+        return best;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    auto count = argc > 1 ? std::atoi(argv[1]) : 720;
+    auto radius = argc > 2 ? static_cast<float>(std::atof(argv[2])) : 30.f;
+
+    // A few people sized blobs and a wall, roughly what one revolution in a room looks like
+    std::mt19937 random(7);
+    std::normal_distribution<float> spread(0.f, 12.f);
+    std::uniform_real_distribution<float> along(-300.f, 300.f);
+    std::vector<Point> points;
+    for (int i = 0; i < count; i++) {
+        if (i % 3 == 0) {
+            points.push_back({along(random), 350.f, 0, 0});
+        } else {
+            auto blob = i % 5;
+            points.push_back({blob * 60.f - 120.f + spread(random), blob * 40.f - 80.f + spread(random), 0, 0});
+        }
+    }
+
+    std::vector<float> xs, ys;
+    std::vector<uint32_t> packed;
+    for (const auto& p : points) {
+        xs.push_back(p.x);
+        ys.push_back(p.y);
+        packed.push_back(ZGDistanceKernels::packMillimeters(p.x, p.y));
+    }
+    std::vector<int> indices(count);
+    auto radius_squared = radius * radius;
+    auto radius_mm = radius * 10.f;
+    auto radius_squared_mm = static_cast<int32_t>(radius_mm * radius_mm);
+
+    long hypot_total = 0;
+    auto hypot_us = timeQueries(count, hypot_total, [&](int q) {
+        auto found = 0;
+        for (int i = 0; i < count; i++) {
+            if (std::hypot(points[q].x - points[i].x, points[q].y - points[i].y) <= radius) {
+                indices[found++] = i;
+            }
+        }
+        return found;
+    });
+
+    long scalar_total = 0;
+    auto scalar_us = timeQueries(count, scalar_total, [&](int q) {
+        return ZGDistanceKernels::findNeighboursScalar(xs.data(), ys.data(), count, xs[q], ys[q], radius_squared,
+                                                       indices.data());
+    });
+
+    long simd_total = 0;
+    auto simd_us = timeQueries(count, simd_total, [&](int q) {
+        return ZGDistanceKernels::findNeighboursSIMD(xs.data(), ys.data(), count, xs[q], ys[q], radius_squared,
+                                                     indices.data());
+    });
+
+    long packed_total = 0;
+    auto packed_us = timeQueries(count, packed_total, [&](int q) {
+        return ZGDistanceKernels::findNeighboursPacked(packed.data(), count, packed[q], radius_squared_mm,
+                                                       indices.data());
+    });
+
+#if defined(__AVX__)
+    const char* simd_name = "SoA AVX";
+#elif defined(__SSE2__)
+    const char* simd_name = "SoA SSE2";
+#else
+    const char* simd_name = "SoA (no SIMD)";
+#endif
+
+    std::printf("%d points, %.1f cm radius, %d queries per pass, best of %d passes\n\n", count, radius, count, REPEATS);
+    std::printf("%-20s %12s %12s %10s\n", "Kernel", "Neighbours", "us / pass", "Speedup");
+    std::printf("%-20s %12ld %12.1f %10.2f\n", "AoS hypot", hypot_total, hypot_us, 1.0);
+    std::printf("%-20s %12ld %12.1f %10.2f\n", "SoA squared", scalar_total, scalar_us, hypot_us / scalar_us);
+    std::printf("%-20s %12ld %12.1f %10.2f\n", simd_name, simd_total, simd_us, hypot_us / simd_us);
+    std::printf("%-20s %12ld %12.1f %10.2f\n", "Packed mm", packed_total, packed_us, hypot_us / packed_us);
+
+    // Rounding to mm and squaring in float can move points sitting exactly on the radius, allow a handful
+    auto mismatch = std::labs(scalar_total - hypot_total) + std::labs(simd_total - hypot_total)
+            + std::labs(packed_total - hypot_total);
+    if (mismatch > hypot_total / 1000) {
+        std::printf("\nneighbour counts differ from the hypot reference\n");
+        return 1;
+    }
+    return 0;
+}
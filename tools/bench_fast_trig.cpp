@@ -0,0 +1,169 @@
+//
+// bench_fast_trig.cpp
+// Teensy 4.1
+//
+// Created by Zane Golas on 10/19/26.
+// Copyright (c) 2026 Zane Golas. All rights reserved.
+//
+// Host accuracy check and microbenchmark for src/ZGFastTrig.h. The table sine and cosine and the polynomial atan2 are
+// swept against double precision first and the run fails if either exceeds the bound documented in the header. Then
+// one revolution of samples is converted both ways with the old fmod, cos, sin and atan2, hypot helpers, with the
+// fast functions one point at a time and with the batched array conversions.
+//
+// On the Teensy the conversions are part of the Processing row of the latency page.
+//
+// Usage:
+//   g++ -std=gnu++14 -O2 -Isrc tools/bench_fast_trig.cpp src/ZGFastTrig.cpp -o bench_fast_trig
+//   ./bench_fast_trig [samples]
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "ZGFastTrig.h"
+
+namespace {
+
+    constexpr int REPEATS = 200;
+    constexpr double SINE_BOUND = 2e-5;
+    constexpr double ATAN_BOUND = 5e-5; // degrees
+
+    template<typename Convert>
+    double timeConversions(double& outChecksum, Convert inConvert) {
+        auto best = 1e30;
+        for (int repeat = 0; repeat < REPEATS; repeat++) {
+            auto start = std::chrono::steady_clock::now();
+            outChecksum = inConvert();
+            auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+            best = std::min(best, elapsed);
+        }
+        return best;
+    }
+
+    // The helpers in ZGConversionHelpers.h before the fast versions replaced them
+    void referencePolarToCartesian(float inAngleDegrees, float inDistanceCm, float& outX, float& outY) {
+        float angle_radians = std::fmod(inAngleDegrees, 360.0f) * (M_PI / 180.0f);
+        outX = inDistanceCm * std::cos(angle_radians);
+        outY = inDistanceCm * std::sin(angle_radians);
+    }
+
+    void referenceCartesianToPolar(float inX, float inY, float& outAngle, float& outDistance) {
+        outDistance = std::hypot(inX, inY);
+        float angle_degrees = std::atan2(inY, inX) * (180.0f / M_PI);
+        if (angle_degrees < 0.0f) {
+            angle_degrees += 360.0f;
+        }
+        outAngle = angle_degrees;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    auto count = argc > 1 ? std::atoi(argv[1]) : 720;
+
+    // Accuracy over several turns in both directions, the table has to wrap without fmod
+    double sine_error = 0;
+    for (int i = -2000000; i <= 2000000; i++) {
+        auto degrees = static_cast<float>(i) * 0.00036f;
+        float sine, cosine;
+        ZGFastTrig::sinCosDegrees(degrees, sine, cosine);
+        auto radians = static_cast<double>(degrees) * M_PI / 180.0;
+        sine_error = std::max(sine_error, std::abs(sine - std::sin(radians)));
+        sine_error = std::max(sine_error, std::abs(cosine - std::cos(radians)));
+    }
+
+    double atan_error = 0;
+    for (int i = 0; i < 2000000; i++) {
+        auto radians = static_cast<double>(i) * (2.0 * M_PI / 2000000.0);
+        auto radius = 1.0 + (i % 1000);
+        auto x = static_cast<float>(radius * std::cos(radians));
+        auto y = static_cast<float>(radius * std::sin(radians));
+        auto exact = std::atan2(static_cast<double>(y), static_cast<double>(x)) * 180.0 / M_PI;
+        auto difference = std::abs(ZGFastTrig::atan2Degrees(y, x) - (exact < 0 ? exact + 360.0 : exact));
+        atan_error = std::max(atan_error, std::min(difference, 360.0 - difference));
+    }
+
+    // One revolution of samples, the way the tracker converts them
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> range(20.f, 1000.f);
+    std::vector<float> angles(count), distances(count), xs(count), ys(count);
+    for (int i = 0; i < count; i++) {
+        angles[i] = (static_cast<float>(i) + 0.5f) * (360.f / static_cast<float>(count));
+        distances[i] = range(random);
+    }
+
+    double reference_sum = 0;
+    auto reference_us = timeConversions(reference_sum, [&]() {
+        double sum = 0;
+        for (int i = 0; i < count; i++) {
+            referencePolarToCartesian(angles[i], distances[i], xs[i], ys[i]);
+            sum += xs[i] + ys[i];
+        }
+        return sum;
+    });
+
+    double scalar_sum = 0;
+    auto scalar_us = timeConversions(scalar_sum, [&]() {
+        double sum = 0;
+        for (int i = 0; i < count; i++) {
+            float sine, cosine;
+            ZGFastTrig::sinCosDegrees(angles[i], sine, cosine);
+            xs[i] = distances[i] * cosine;
+            ys[i] = distances[i] * sine;
+            sum += xs[i] + ys[i];
+        }
+        return sum;
+    });
+
+    double batch_sum = 0;
+    auto batch_us = timeConversions(batch_sum, [&]() {
+        ZGFastTrig::polarToCartesian(angles.data(), distances.data(), count, xs.data(), ys.data());
+        double sum = 0;
+        for (int i = 0; i < count; i++) {
+            sum += xs[i] + ys[i];
+        }
+        return sum;
+    });
+
+    std::vector<float> polar_angles(count), polar_distances(count);
+    double reference_polar_sum = 0;
+    auto reference_polar_us = timeConversions(reference_polar_sum, [&]() {
+        double sum = 0;
+        for (int i = 0; i < count; i++) {
+            referenceCartesianToPolar(xs[i], ys[i], polar_angles[i], polar_distances[i]);
+            sum += polar_angles[i] + polar_distances[i];
+        }
+        return sum;
+    });
+
+    double polar_sum = 0;
+    auto polar_us = timeConversions(polar_sum, [&]() {
+        ZGFastTrig::cartesianToPolar(xs.data(), ys.data(), count, polar_angles.data(), polar_distances.data());
+        double sum = 0;
+        for (int i = 0; i < count; i++) {
+            sum += polar_angles[i] + polar_distances[i];
+        }
+        return sum;
+    });
+
+    std::printf("Largest sine/cosine error %.2e (bound %.0e), atan2 error %.2e degrees (bound %.0e)\n\n", sine_error,
+                SINE_BOUND, atan_error, ATAN_BOUND);
+    std::printf("%d samples per pass, best of %d passes\n\n", count, REPEATS);
+    std::printf("%-24s %12s %12s %10s\n", "Conversion", "Checksum", "us / pass", "Speedup");
+    std::printf("%-24s %12.0f %12.2f %10.2f\n", "fmod, cos, sin", reference_sum, reference_us, 1.0);
+    std::printf("%-24s %12.0f %12.2f %10.2f\n", "Table, per point", scalar_sum, scalar_us, reference_us / scalar_us);
+    std::printf("%-24s %12.0f %12.2f %10.2f\n", "Table, batched", batch_sum, batch_us, reference_us / batch_us);
+    std::printf("%-24s %12.0f %12.2f %10.2f\n", "atan2, hypot", reference_polar_sum, reference_polar_us, 1.0);
+    std::printf("%-24s %12.0f %12.2f %10.2f\n", "Polynomial, batched", polar_sum, polar_us,
+                reference_polar_us / polar_us);
+
+    if (sine_error > SINE_BOUND || atan_error > ATAN_BOUND) {
+        std::printf("\nerror exceeds the bound documented in ZGFastTrig.h\n");
+        return 1;
+    }
+    return 0;
+}
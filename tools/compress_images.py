@@ -0,0 +1,131 @@
+#
+# compress_images.py
+# Teensy 4.1
+#
+# Converts the RGB565 arrays produced by ImageConverter 565 into run length encoded
+# arrays that can be drawn with TeensyUserInterface::lcdDrawImageRLE().
+#
+# Every row of the image is encoded on its own so the decoder can stream one line at a
+# time to the LCD. A row is a sequence of packets, each starting with a 16 bit header:
+#   0x8000 | n  ->  one color word follows, repeated n times
+#   n           ->  n literal color words follow
+#
+# Usage:
+#   python3 tools/compress_images.py                 (convert everything in assets/images)
+#   python3 tools/compress_images.py in.c out.c      (convert a single file)
+#
+# The script is also registered as a PlatformIO pre build step in platformio.ini, in which
+# case only images that are newer than their compressed counterpart are regenerated.
+#
+
+import os
+import re
+import sys
+
+MAX_PACKET = 0x7FFF
+MIN_RUN = 3
+
+if __name__ == "__main__":
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+else:
+    # PlatformIO runs extra scripts through SCons, where __file__ is not defined
+    Import("env")
+    PROJECT_DIR = env.subst("$PROJECT_DIR")
+
+SOURCE_DIR = os.path.join(PROJECT_DIR, "assets", "images")
+OUTPUT_DIR = os.path.join(PROJECT_DIR, "src", "assets")
+
+
+def read_image(path):
+    with open(path) as f:
+        text = f.read()
+    size = re.search(r"Image Size\s*:\s*(\d+)x(\d+)", text)
+    name = re.search(r"unsigned short\s+(\w+)\s*\[(\d+)\]", text)
+    body = text[text.index("{", name.end()) + 1:text.rindex("}")]
+    body = re.sub(r"//[^\n]*", "", body)
+    pixels = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", body)]
+    width, height = int(size.group(1)), int(size.group(2))
+
+    # Elements missing from the initializer are zero in C, keep the same behaviour
+    pixels += [0] * (int(name.group(2)) - len(pixels))
+    if len(pixels) != width * height:
+        raise ValueError("{}: expected {} pixels, found {}".format(path, width * height, len(pixels)))
+    return name.group(1), width, height, pixels
+
+
+def encode_row(row):
+    out = []
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_PACKET]
+            del literals[:MAX_PACKET]
+            out.append(len(chunk))
+            out.extend(chunk)
+
+    i = 0
+    while i < len(row):
+        run = 1
+        while i + run < len(row) and row[i + run] == row[i] and run < MAX_PACKET:
+            run += 1
+        if run >= MIN_RUN:
+            flush_literals()
+            out.append(0x8000 | run)
+            out.append(row[i])
+        else:
+            literals.extend(row[i:i + run])
+        i += run
+    flush_literals()
+    return out
+
+
+def encode_image(width, height, pixels):
+    data = []
+    for y in range(height):
+        data.extend(encode_row(pixels[y * width:(y + 1) * width]))
+    return data
+
+
+def write_image(path, name, width, height, data):
+    with open(path, "w") as f:
+        f.write("// Generated by   : tools/compress_images.py\n")
+        f.write("// Generated from : {}.c\n".format(name))
+        f.write("// Image Size     : {}x{} pixels\n".format(width, height))
+        f.write("// Memory usage   : {} bytes ({} bytes uncompressed)\n".format(len(data) * 2, width * height * 2))
+        f.write("// Draw with      : lcdDrawImageRLE()\n\n")
+        f.write("#include <Arduino.h>\n\n")
+        f.write("FLASHMEM const unsigned short {}RLE[{}] ={{\n".format(name, len(data)))
+        for i in range(0, len(data), 16):
+            f.write(", ".join("0x{:04X}".format(v) for v in data[i:i + 16]) + ",\n")
+        f.write("};\n")
+
+
+def convert(source, destination=None):
+    name, width, height, pixels = read_image(source)
+    if destination is None:
+        destination = os.path.join(OUTPUT_DIR, name + "RLE.c")
+    data = encode_image(width, height, pixels)
+    write_image(destination, name, width, height, data)
+    print("{}: {} -> {} bytes".format(name, width * height * 2, len(data) * 2))
+
+
+def convert_all(only_stale):
+    for file_name in sorted(os.listdir(SOURCE_DIR)):
+        if not file_name.endswith(".c"):
+            continue
+        source = os.path.join(SOURCE_DIR, file_name)
+        destination = os.path.join(OUTPUT_DIR, file_name[:-2] + "RLE.c")
+        if only_stale and os.path.exists(destination) and os.path.getmtime(destination) >= os.path.getmtime(source):
+            continue
+        convert(source, destination)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) == 3:
+        convert(sys.argv[1], sys.argv[2])
+    else:
+        convert_all(False)
+else:
+    # Executed by PlatformIO as an extra script
+    convert_all(True)
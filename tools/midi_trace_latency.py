@@ -0,0 +1,123 @@
+#
+# midi_trace_latency.py
+# Teensy 4.1
+#
+# Reads a MIDI trace exported from the DISPLAY menu (midi_trace.csv from the SD card, or a
+# serial capture of the same CSV) and prints the distribution of the time from the lidar
+# sample behind each message until it was sent, per message type.
+#
+# Each trace line is: revolution,status,data1,data2,sample_us,send_us
+# Messages with a sample time of 0 were sent from the menu and are counted separately.
+# Anything before the header line, such as other serial output, is skipped.
+#
+# Usage:
+#   python3 tools/midi_trace_latency.py midi_trace.csv
+#   python3 tools/midi_trace_latency.py --histogram midi_trace.csv
+#
+
+import sys
+
+HEADER = "revolution,status,data1,data2,sample_us,send_us"
+PERCENTILES = (50, 95, 99)
+HISTOGRAM_WIDTH = 50
+
+# Status byte high nibble -> name
+MESSAGE_TYPES = {
+    0x8: "Note Off",
+    0x9: "Note On",
+    0xB: "Control Change",
+    0xD: "Channel Pressure",
+    0xE: "Pitch Bend",
+}
+
+
+def read_trace(lines):
+    entries = []
+    in_trace = False
+    for line in lines:
+        line = line.strip()
+        if line == HEADER:
+            # A new dump restarts the trace, only the latest one in a capture is used
+            entries = []
+            in_trace = True
+            continue
+        if not in_trace or not line:
+            continue
+        fields = line.split(",")
+        if len(fields) != 6 or not all(f.isdigit() for f in fields):
+            in_trace = False
+            continue
+        revolution, status, data1, data2, sample_us, send_us = (int(f) for f in fields)
+        entries.append((revolution, status, data1, data2, sample_us, send_us))
+    return entries
+
+
+def percentile(sorted_values, percent):
+    # Nearest rank
+    index = max(0, -(-len(sorted_values) * percent // 100) - 1)
+    return sorted_values[index]
+
+
+def latencies_by_type(entries):
+    by_type = {}
+    untagged = 0
+    for revolution, status, data1, data2, sample_us, send_us in entries:
+        if sample_us == 0:
+            untagged += 1
+            continue
+        # micros() wraps every 71 minutes
+        latency = (send_us - sample_us) & 0xFFFFFFFF
+        name = MESSAGE_TYPES.get(status >> 4, "Status 0x{:02X}".format(status & 0xF0))
+        by_type.setdefault(name, []).append(latency)
+    return by_type, untagged
+
+
+def print_histogram(values):
+    # Power of two bins, the same spacing the latency page uses at a coarser resolution
+    bins = {}
+    for value in values:
+        bins[value.bit_length()] = bins.get(value.bit_length(), 0) + 1
+    largest = max(bins.values())
+    for bit in range(min(bins), max(bins) + 1):
+        count = bins.get(bit, 0)
+        low = 0 if bit == 0 else 1 << (bit - 1)
+        bar = "#" * (count * HISTOGRAM_WIDTH // largest)
+        print("    {:>8} us  {:>6}  {}".format(low, count, bar))
+
+
+def report(entries, histogram):
+    by_type, untagged = latencies_by_type(entries)
+    revolutions = len(set(entry[0] for entry in entries))
+    print("{} messages over {} revolutions, {} not caused by a sample".format(len(entries), revolutions, untagged))
+    print()
+    print("{:<18} {:>7} {:>9} {:>9} {:>9} {:>9} {:>9}".format("Type", "Count", "Min us", "p50 us", "p95 us", "p99 us",
+                                                            "Max us"))
+    all_latencies = []
+    for name in sorted(by_type):
+        values = sorted(by_type[name])
+        all_latencies.extend(values)
+        print("{:<18} {:>7} {:>9} {:>9} {:>9} {:>9} {:>9}".format(
+            name, len(values), values[0], *(percentile(values, p) for p in PERCENTILES), values[-1]))
+    if all_latencies:
+        values = sorted(all_latencies)
+        print("{:<18} {:>7} {:>9} {:>9} {:>9} {:>9} {:>9}".format(
+            "All", len(values), values[0], *(percentile(values, p) for p in PERCENTILES), values[-1]))
+
+    if histogram:
+        for name in sorted(by_type):
+            print()
+            print(name)
+            print_histogram(by_type[name])
+
+
+if __name__ == "__main__":
+    arguments = [a for a in sys.argv[1:] if a != "--histogram"]
+    if len(arguments) != 1:
+        print("usage: python3 tools/midi_trace_latency.py [--histogram] midi_trace.csv")
+        sys.exit(1)
+    with open(arguments[0], errors="replace") as f:
+        trace = read_trace(f)
+    if not trace:
+        print("no trace found in {}".format(arguments[0]))
+        sys.exit(1)
+    report(trace, "--histogram" in sys.argv)